@@ -0,0 +1,370 @@
+// DriftBenchmark.cpp
+// Drift numerik komposisi rotasi kecil yang panjang (current = current * step, 10^6 - 10^9 langkah) buat
+// Quaternion & Matrix4, float & double, dengan berbagai cara renormalisasi (lihat math::RenormalizeMethod).
+//
+// Tiap konfigurasi dijalankan dua kali:
+//   1. throughput: komposisi + renormalisasi saja, diukur ns/langkah
+//   2. error: sama persis, plus referensi long double di sampingnya; di checkpoint 1, 2, 5 x 10^k dicatat
+//      error norma (| |q|^2 - 1 | atau max |R^T R - I|) dan error orientasi (sudut antara hasil & referensi, rad)
+//
+// Langkahnya diambil bergiliran dari tabel STEP_TABLE_SIZE rotasi acak (deterministik) supaya yang diukur cuma
+// komposisinya. Referensi memakai langkah quaternion yang sudah dibulatkan ke T, jadi error orientasi murni dari
+// komposisi + renormalisasi (buat Matrix4 ditambah pembulatan fromQuaternion ke T)
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../modules/math/Quaternion.hpp"
+#include "../modules/math/Matrix4.hpp"
+#include "../modules/math/Renormalization.hpp"
+
+namespace {
+    using math::Matrix4;
+    using math::Quaternion;
+    using math::RenormalizeMethod;
+    using Exact = long double;
+
+    constexpr size_t STEP_TABLE_SIZE = 4096; // pangkat 2 (index di-mask)
+
+    struct Options {
+        uint64_t steps = 1000000;
+        double stepDegrees = 0.5;
+        std::vector<uint64_t> intervals = {1, 100};
+        std::string csvPath;
+        bool runFloat = true;
+        bool runDouble = true;
+        bool runQuaternion = true;
+        bool runMatrix = true;
+    };
+
+    struct Config {
+        bool matrix;
+        RenormalizeMethod method;
+        uint64_t interval; // renormalisasi tiap `interval` langkah (diabaikan kalau NONE)
+    };
+
+    struct Checkpoint {
+        uint64_t step;
+        Exact normError;
+        Exact angleError;
+    };
+
+    struct Result {
+        std::string type;
+        Config config;
+        double nanosecondsPerStep = 0.0;
+        std::vector<Checkpoint> curve;
+    };
+
+    void printUsage(const char* programName) {
+        std::cout << "Pemakaian: " << programName << " [--steps N=1e6] [--angle DERAJAT=0.5] [--interval N,N,...=1,100]\n"
+                  << "                [--float | --double] [--quaternion | --matrix] [--csv FILE]" << std::endl;
+    }
+
+    std::string configLabel(const Config& config) {
+        std::string label = math::renormalizeMethodName(config.method);
+        if (config.method != RenormalizeMethod::NONE) {
+            label += "/" + std::to_string(config.interval);
+        }
+        return label;
+    }
+
+    std::vector<Config> buildConfigs(const Options& options) {
+        std::vector<Config> configs;
+        if (options.runQuaternion) {
+            configs.push_back({false, RenormalizeMethod::NONE, 0});
+            for (RenormalizeMethod method : {RenormalizeMethod::NORMALIZE, RenormalizeMethod::FAST_NORMALIZE}) {
+                for (uint64_t interval : options.intervals) configs.push_back({false, method, interval});
+            }
+        }
+        if (options.runMatrix) {
+            configs.push_back({true, RenormalizeMethod::NONE, 0});
+            for (RenormalizeMethod method : {RenormalizeMethod::GRAM_SCHMIDT, RenormalizeMethod::FAST_ORTHONORMALIZE,
+                                             RenormalizeMethod::VIA_QUATERNION}) {
+                for (uint64_t interval : options.intervals) configs.push_back({true, method, interval});
+            }
+        }
+        return configs;
+    }
+
+    // 1, 2, 5, 10, 20, 50, ... <= steps, plus steps sendiri
+    std::vector<uint64_t> buildCheckpoints(uint64_t steps) {
+        std::vector<uint64_t> checkpoints;
+        for (uint64_t decade = 1; decade <= steps; decade *= 10) {
+            for (uint64_t factor : {1, 2, 5}) {
+                if (decade * factor <= steps) checkpoints.push_back(decade * factor);
+            }
+            if (decade > steps / 10) break;
+        }
+        if (checkpoints.empty() || checkpoints.back() != steps) checkpoints.push_back(steps);
+        return checkpoints;
+    }
+
+    // sumbu acak (xorshift64, deterministik) dengan sudut tetap, dihitung di long double
+    std::vector<Quaternion<Exact>> buildExactSteps(double stepDegrees) {
+        std::vector<Quaternion<Exact>> steps(STEP_TABLE_SIZE);
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+        auto next = [&state]() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return static_cast<Exact>(state >> 11) / static_cast<Exact>(1ull << 53) * 2 - 1;
+        };
+        Exact halfAngle = static_cast<Exact>(stepDegrees) * 3.14159265358979323846264338327950288L / 360;
+        for (auto& step : steps) {
+            Exact x, y, z, lengthSquared;
+            do {
+                x = next();
+                y = next();
+                z = next();
+                lengthSquared = x * x + y * y + z * z;
+            } while (lengthSquared < 1e-4L || lengthSquared > 1);
+            Exact scale = std::sin(halfAngle) / std::sqrt(lengthSquared);
+            step = Quaternion<Exact>(std::cos(halfAngle), x * scale, y * scale, z * scale);
+        }
+        return steps;
+    }
+
+    template<typename T>
+    Quaternion<Exact> lift(const Quaternion<T>& q) {
+        return Quaternion<Exact>(q.w, q.x, q.y, q.z);
+    }
+
+    template<typename T>
+    Matrix4<Exact> lift(const Matrix4<T>& m) {
+        typename Matrix4<T>::ArrayType data = m.getData();
+        typename Matrix4<Exact>::ArrayType exact;
+        for (int i = 0; i < 16; ++i) exact[i] = data[i];
+        return Matrix4<Exact>(exact);
+    }
+
+    Exact normError(const Quaternion<Exact>& q) { return math::Renormalization<Exact>::normError(q); }
+    Exact normError(const Matrix4<Exact>& m) { return math::Renormalization<Exact>::orthogonalityError(m); }
+
+    // sudut rotasi conj(reference) * normalize(q)
+    Exact angleError(const Quaternion<Exact>& q, const Quaternion<Exact>& reference) {
+        Quaternion<Exact> difference = reference.conjugate() * q.normalize();
+        Exact vectorLength = std::sqrt(difference.x * difference.x + difference.y * difference.y + difference.z * difference.z);
+        return 2 * std::atan2(vectorLength, std::abs(difference.w));
+    }
+
+    // sudut D = Rref^T R dari bagian skew-nya; skala/non-ortogonalitas R masuk ke bagian simetris, jadi nggak ikut
+    Exact angleError(const Matrix4<Exact>& m, const Quaternion<Exact>& reference) {
+        const Matrix4<Exact> expected = Matrix4<Exact>::fromQuaternion(reference);
+        Exact d[3][3];
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                d[i][j] = expected(0, i) * m(0, j) + expected(1, i) * m(1, j) + expected(2, i) * m(2, j);
+            }
+        }
+        Exact sx = (d[2][1] - d[1][2]) / 2, sy = (d[0][2] - d[2][0]) / 2, sz = (d[1][0] - d[0][1]) / 2;
+        return std::atan2(std::sqrt(sx * sx + sy * sy + sz * sz), (d[0][0] + d[1][1] + d[2][2] - 1) / 2);
+    }
+
+    // TRACK = false: cuma komposisi (buat ukur waktu). TRACK = true: plus referensi & checkpoint.
+    // Loop-nya sama persis di kedua mode supaya hasil numeriknya identik
+    template<typename T, typename Rotation, bool TRACK>
+    Rotation compose(const std::vector<Rotation>& steps, const std::vector<Quaternion<Exact>>& referenceSteps,
+                     const Config& config, uint64_t count, const std::vector<uint64_t>& checkpoints,
+                     std::vector<Checkpoint>& curve) {
+        Rotation current; // identitas
+        Quaternion<Exact> reference;
+        const uint64_t interval = config.method == RenormalizeMethod::NONE ? 0 : config.interval;
+        uint64_t untilRenormalize = interval;
+        size_t nextCheckpoint = 0;
+
+        for (uint64_t i = 0; i < count; ++i) {
+            size_t index = static_cast<size_t>(i) & (STEP_TABLE_SIZE - 1);
+            current = current * steps[index];
+            if (interval != 0 && --untilRenormalize == 0) {
+                current = math::Renormalization<T>::apply(config.method, current);
+                untilRenormalize = interval;
+            }
+            if (TRACK) {
+                reference = (reference * referenceSteps[index]).normalize();
+                if (nextCheckpoint < checkpoints.size() && i + 1 == checkpoints[nextCheckpoint]) {
+                    auto exact = lift(current);
+                    curve.push_back({i + 1, normError(exact), angleError(exact, reference)});
+                    ++nextCheckpoint;
+                }
+            }
+        }
+        return current;
+    }
+
+    template<typename T, typename Rotation>
+    void runConfig(const std::vector<Rotation>& steps, const std::vector<Quaternion<Exact>>& referenceSteps,
+                  const Options& options, const std::vector<uint64_t>& checkpoints, Result& result) {
+        std::vector<Checkpoint> unused;
+        auto start = std::chrono::steady_clock::now();
+        Rotation last = compose<T, Rotation, false>(steps, referenceSteps, result.config, options.steps, checkpoints, unused);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        result.nanosecondsPerStep = seconds * 1e9 / static_cast<double>(options.steps);
+        // pakai hasilnya supaya loop waktu nggak dibuang compiler
+        volatile Exact sink = normError(lift(last));
+        (void)sink;
+
+        compose<T, Rotation, true>(steps, referenceSteps, result.config, options.steps, checkpoints, result.curve);
+    }
+
+    template<typename T>
+    void runType(const std::string& typeName, const std::vector<Quaternion<Exact>>& exactSteps, const Options& options,
+                const std::vector<Config>& configs, const std::vector<uint64_t>& checkpoints, std::vector<Result>& results) {
+        std::vector<Quaternion<T>> quaternionSteps(STEP_TABLE_SIZE);
+        std::vector<Matrix4<T>> matrixSteps(STEP_TABLE_SIZE);
+        std::vector<Quaternion<Exact>> referenceSteps(STEP_TABLE_SIZE);
+        for (size_t i = 0; i < STEP_TABLE_SIZE; ++i) {
+            const Quaternion<Exact>& exact = exactSteps[i];
+            quaternionSteps[i] = Quaternion<T>(static_cast<T>(exact.w), static_cast<T>(exact.x), static_cast<T>(exact.y), static_cast<T>(exact.z));
+            matrixSteps[i] = Matrix4<T>::fromQuaternion(quaternionSteps[i]);
+            referenceSteps[i] = lift(quaternionSteps[i]).normalize();
+        }
+
+        for (const Config& config : configs) {
+            Result result;
+            result.type = typeName;
+            result.config = config;
+            if (config.matrix) {
+                runConfig<T>(matrixSteps, referenceSteps, options, checkpoints, result);
+            } else {
+                runConfig<T>(quaternionSteps, referenceSteps, options, checkpoints, result);
+            }
+            std::cout << "  " << std::left << std::setw(7) << typeName << std::setw(11) << (config.matrix ? "Matrix4" : "Quaternion")
+                      << std::setw(24) << configLabel(config) << std::right << std::fixed << std::setprecision(2)
+                      << std::setw(8) << result.nanosecondsPerStep << " ns/langkah   akhir: norma "
+                      << std::scientific << std::setprecision(2) << static_cast<double>(result.curve.back().normError)
+                      << ", sudut " << static_cast<double>(result.curve.back().angleError) << " rad" << std::endl;
+            results.push_back(std::move(result));
+        }
+    }
+
+    // satu tabel per (tipe, representasi, metrik): baris = checkpoint 10^k, kolom = konfigurasi
+    void printCurves(const std::vector<Result>& results, const std::string& type, bool matrix, bool angle) {
+        std::vector<const Result*> columns;
+        for (const Result& result : results) {
+            if (result.type == type && result.config.matrix == matrix) columns.push_back(&result);
+        }
+        if (columns.empty()) return;
+
+        std::cout << "\n" << type << " " << (matrix ? "Matrix4" : "Quaternion") << " - "
+                  << (angle ? "error sudut (rad)" : (matrix ? "max |R^T R - I|" : "| |q|^2 - 1 |")) << "\n";
+        std::cout << std::setw(12) << "langkah";
+        for (const Result* column : columns) std::cout << std::setw(25) << configLabel(column->config);
+        std::cout << "\n";
+
+        const std::vector<Checkpoint>& reference = columns.front()->curve;
+        for (size_t row = 0; row < reference.size(); ++row) {
+            uint64_t step = reference[row].step;
+            bool decade = row + 1 == reference.size();
+            for (uint64_t power = 1; power <= step && !decade; power *= 10) decade = power == step;
+            if (!decade) continue;
+
+            std::cout << std::setw(12) << step;
+            for (const Result* column : columns) {
+                const Checkpoint& point = column->curve[row];
+                std::cout << std::setw(25) << std::scientific << std::setprecision(2)
+                          << static_cast<double>(angle ? point.angleError : point.normError);
+            }
+            std::cout << "\n";
+        }
+    }
+
+    bool writeCsv(const std::string& path, const std::vector<Result>& results) {
+        std::ofstream file(path);
+        if (!file) {
+            std::cerr << "Gagal menulis CSV: " << path << std::endl;
+            return false;
+        }
+        file << "type,representation,method,interval,step,norm_error,angle_error_rad,ns_per_step\n";
+        file << std::setprecision(6);
+        for (const Result& result : results) {
+            for (const Checkpoint& point : result.curve) {
+                file << result.type << "," << (result.config.matrix ? "matrix4" : "quaternion") << ","
+                     << math::renormalizeMethodName(result.config.method) << "," << result.config.interval << ","
+                     << point.step << "," << static_cast<double>(point.normError) << ","
+                     << static_cast<double>(point.angleError) << "," << result.nanosecondsPerStep << "\n";
+            }
+        }
+        return true;
+    }
+
+    bool parseIntervals(const std::string& text, std::vector<uint64_t>& intervals) {
+        intervals.clear();
+        std::stringstream stream(text);
+        std::string item;
+        while (std::getline(stream, item, ',')) {
+            double value = std::stod(item);
+            if (!(value >= 1)) return false;
+            intervals.push_back(static_cast<uint64_t>(value));
+        }
+        return !intervals.empty();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--steps" && hasValue) {
+                // boleh 1e9
+                double steps = std::stod(argv[++i]);
+                if (!(steps >= 1)) throw std::invalid_argument("steps");
+                options.steps = static_cast<uint64_t>(steps);
+            } else if (arg == "--angle" && hasValue) {
+                options.stepDegrees = std::stod(argv[++i]);
+            } else if (arg == "--interval" && hasValue) {
+                if (!parseIntervals(argv[++i], options.intervals)) throw std::invalid_argument("interval");
+            } else if (arg == "--csv" && hasValue) {
+                options.csvPath = argv[++i];
+            } else if (arg == "--float") {
+                options.runDouble = false;
+            } else if (arg == "--double") {
+                options.runFloat = false;
+            } else if (arg == "--quaternion") {
+                options.runMatrix = false;
+            } else if (arg == "--matrix") {
+                options.runQuaternion = false;
+            } else {
+                printUsage(argv[0]);
+                return arg == "-h" || arg == "--help" ? 0 : 1;
+            }
+        }
+    } catch (const std::exception&) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::vector<Config> configs = buildConfigs(options);
+    std::vector<uint64_t> checkpoints = buildCheckpoints(options.steps);
+    std::vector<Quaternion<Exact>> exactSteps = buildExactSteps(options.stepDegrees);
+
+    std::cout << "Drift komposisi: " << options.steps << " langkah " << options.stepDegrees << " derajat (tabel "
+              << STEP_TABLE_SIZE << " sumbu acak), kernel Matrix4 float " << Matrix4<float>::kernels().name
+              << ", double " << Matrix4<double>::kernels().name << "\n" << std::endl;
+
+    std::vector<Result> results;
+    if (options.runFloat) runType<float>("float", exactSteps, options, configs, checkpoints, results);
+    if (options.runDouble) runType<double>("double", exactSteps, options, configs, checkpoints, results);
+
+    for (const char* type : {"float", "double"}) {
+        for (bool matrix : {false, true}) {
+            printCurves(results, type, matrix, false);
+            printCurves(results, type, matrix, true);
+        }
+    }
+    std::cout << std::flush;
+
+    if (!options.csvPath.empty() && !writeCsv(options.csvPath, results)) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,51 @@
+// FuzzyFilterCheck.cpp
+// Cek ui::FuzzyFilter waktu daftarnya dibangun ulang (mis. FileDialog tiap ModelIndex publish): hasil filter harus
+// selalu nunjuk ke daftar yang baru, baik tanpa query maupun dengan query, dan daftar yang lebih pendek maupun
+// lebih panjang. Exit code 1 kalau ada yang beda
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../modules/ui/FuzzyFilter.hpp"
+
+namespace {
+    // match tanpa query = semua index urut; dengan query = index yang namanya mengandung query sebagai subsequence
+    bool checkMatches(const char* label, const ui::FuzzyFilter& filter, const std::vector<uint32_t>& expected) {
+        const std::vector<uint32_t>& matches = filter.getMatches();
+        bool passed = matches == expected;
+        std::cout << label << ": " << matches.size() << " match (harusnya " << expected.size() << ")"
+                  << (passed ? "  OK" : "  GAGAL") << std::endl;
+        return passed;
+    }
+
+    void rebuild(ui::FuzzyFilter& filter, const std::vector<std::string>& names) {
+        filter.build(names, [](const std::string& name) -> const std::string& { return name; });
+    }
+}
+
+int main() {
+    const std::vector<std::string> three = {"bunny.obj", "dragon.ply", "teapot.obj"};
+    const std::vector<std::string> one = {"teapot.obj"};
+    const std::vector<std::string> four = {"armadillo.ply", "bunny.obj", "dragon.ply", "teapot.obj"};
+    bool passed = true;
+
+    ui::FuzzyFilter filter;
+    rebuild(filter, three);
+    passed = checkMatches("tanpa query, 3 nama", filter, {0, 1, 2}) && passed;
+    rebuild(filter, one);
+    passed = checkMatches("tanpa query, bangun ulang jadi 1 nama", filter, {0}) && passed;
+    rebuild(filter, four);
+    passed = checkMatches("tanpa query, bangun ulang jadi 4 nama", filter, {0, 1, 2, 3}) && passed;
+
+    filter.setQuery("ply");
+    passed = checkMatches("query \"ply\", 4 nama", filter, {0, 2}) && passed;
+    rebuild(filter, one);
+    passed = checkMatches("query \"ply\", bangun ulang jadi 1 nama", filter, {}) && passed;
+    rebuild(filter, three);
+    passed = checkMatches("query \"ply\", bangun ulang jadi 3 nama", filter, {1}) && passed;
+
+    filter.setQuery("");
+    rebuild(filter, four);
+    passed = checkMatches("query dihapus, bangun ulang jadi 4 nama", filter, {0, 1, 2, 3}) && passed;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,378 @@
+// MathBenchmark.cpp
+// Microbenchmark throughput template math (Quaternion, Matrix4, EulerAngles, TaitBryanAngles), float & double,
+// versi satuan (scalar: API per elemen dipanggil dalam loop) dan batch (API vector/SoA sekali panggil).
+//
+// Supaya angkanya stabil (mis. dijalankan di CI):
+//   - proses dikunci ke satu CPU (sched_setaffinity) sebelum mengukur
+//   - tiap kasus di-warmup dulu (cache, branch predictor, pemilihan kernel SIMD, frekuensi CPU)
+//   - jumlah panggilan per sampel dikalibrasi sampai satu sampel >= --sample detik, lalu diambil median dari
+//     beberapa sampel; sebaran (median deviasi absolut / median) ikut dilaporkan biar kelihatan kalau noisy
+//
+// Tiap panggilan memproses ELEMENT_COUNT elemen dari data acak yang muat di L1/L2, jadi yang diukur throughput
+// (bukan latency rantai dependen)
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "../modules/math/Vector3.hpp"
+#include "../modules/math/Vector4.hpp"
+#include "../modules/math/Quaternion.hpp"
+#include "../modules/math/Matrix4.hpp"
+#include "../modules/math/EulerAngles.hpp"
+#include "../modules/math/QuaternionBatch.hpp"
+
+namespace {
+    using math::Matrix4;
+    using math::Quaternion;
+    using math::Vector3;
+    using math::Vector4;
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t ELEMENT_COUNT = 1024;
+
+    struct Options {
+        double warmupSeconds = 0.2;
+        double sampleSeconds = 0.02;
+        int repetitions = 15;
+        int cpu = -1; // -1 = CPU pertama yang diizinkan
+        std::string filter;
+        std::string csvPath;
+    };
+
+    struct Case {
+        std::string name;
+        std::string type;
+        bool batch;
+        std::function<void()> call; // satu panggilan = ELEMENT_COUNT operasi
+    };
+
+    struct Measurement {
+        double nanosecondsPerOp;
+        double minimumNanosecondsPerOp;
+        double spread; // median |sampel - median| / median
+    };
+
+    // cegah compiler membuang hasil yang nggak dipakai (GCC/Clang)
+    template<typename T>
+    inline void keep(const T& value) {
+        asm volatile("" : : "r"(&value) : "memory");
+    }
+
+    void printUsage(const char* programName) {
+        std::cout << "Pemakaian: " << programName << " [--quick] [--filter TEKS] [--cpu N] [--repetitions N]\n"
+                  << "                [--warmup DETIK] [--sample DETIK] [--csv FILE]" << std::endl;
+    }
+
+    // kunci ke satu CPU supaya nggak pindah core (cache & frekuensi berubah) di tengah pengukuran
+    int pinToCpu(int cpu) {
+#ifdef __linux__
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return -1;
+        if (cpu < 0) {
+            for (int i = 0; i < CPU_SETSIZE; ++i) {
+                if (CPU_ISSET(i, &allowed)) {
+                    cpu = i;
+                    break;
+                }
+            }
+        }
+        if (cpu < 0 || cpu >= CPU_SETSIZE || !CPU_ISSET(cpu, &allowed)) return -1;
+        cpu_set_t target;
+        CPU_ZERO(&target);
+        CPU_SET(cpu, &target);
+        return sched_setaffinity(0, sizeof(target), &target) == 0 ? cpu : -1;
+#else
+        (void)cpu;
+        return -1;
+#endif
+    }
+
+    template<typename T>
+    struct Inputs {
+        std::vector<T> scalars;
+        std::vector<Vector3<T>> axes, vectors, angles, vectorOut;
+        std::vector<Quaternion<T>> quaternionsA, quaternionsB, quaternionOut;
+        std::vector<Matrix4<T>> rotations, rigids, projectives, matrixOut;
+        std::vector<Vector4<T>> points, pointOut;
+        math::QuaternionArray<T> quaternionArray, quaternionArrayOut;
+        math::Vector3Array<T> vectorArray, vectorArrayOut;
+
+        Inputs() {
+            uint32_t state = 0x12345678u;
+            auto next = [&state]() {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                return static_cast<T>(state >> 8) / static_cast<T>(1u << 24) * 2 - 1; // [-1, 1)
+            };
+
+            scalars.resize(ELEMENT_COUNT);
+            quaternionOut.resize(ELEMENT_COUNT);
+            matrixOut.resize(ELEMENT_COUNT);
+            pointOut.resize(ELEMENT_COUNT);
+            vectorOut.resize(ELEMENT_COUNT);
+            for (size_t i = 0; i < ELEMENT_COUNT; ++i) {
+                scalars[i] = next() * static_cast<T>(3.14159265);
+                axes.push_back(Vector3<T>(next(), next(), static_cast<T>(1)).normalize());
+                vectors.push_back(Vector3<T>(next(), next(), next()) * static_cast<T>(10));
+                angles.push_back(Vector3<T>(next(), next(), next()) * static_cast<T>(180));
+                quaternionsA.push_back(Quaternion<T>(next(), next(), next(), next()).normalize());
+                quaternionsB.push_back(Quaternion<T>(next(), next(), next(), next()).normalize());
+                rotations.push_back(Matrix4<T>::fromQuaternion(quaternionsA[i]));
+                rigids.push_back(Matrix4<T>::translation(vectors[i]) * rotations[i]);
+                projectives.push_back(Matrix4<T>::perspective(static_cast<T>(0.8), static_cast<T>(1.6), static_cast<T>(0.1), static_cast<T>(100)) * rigids[i]);
+                points.push_back(Vector4<T>(vectors[i], static_cast<T>(1)));
+                quaternionArray.push_back(quaternionsA[i]);
+            }
+            quaternionArrayOut = quaternionArray;
+            vectorArray.assign(vectors);
+            vectorArrayOut = vectorArray;
+        }
+    };
+
+    template<typename T>
+    void addCases(const std::string& type, Inputs<T>& in, std::vector<Case>& cases) {
+        const size_t n = ELEMENT_COUNT;
+        auto add = [&](const std::string& name, bool batch, std::function<void()> call) {
+            cases.push_back({name, type, batch, std::move(call)});
+        };
+
+        // --- Quaternion ---
+        add("Quaternion::fromAxisAngle", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) in.quaternionOut[i] = Quaternion<T>::fromAxisAngle(in.axes[i], in.scalars[i]);
+            keep(in.quaternionOut[0]);
+        });
+        add("Quaternion::operator*", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) in.quaternionOut[i] = in.quaternionsA[i] * in.quaternionsB[i];
+            keep(in.quaternionOut[0]);
+        });
+        add("Quaternion::multiplyBatch", true, [&in, n]() {
+            Quaternion<T>::multiplyBatch(in.quaternionsA.data(), in.quaternionsB.data(), in.quaternionOut.data(), n);
+            keep(in.quaternionOut[0]);
+        });
+        add("Quaternion::rotate", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) in.vectorOut[i] = in.quaternionsA[i].rotate(in.vectors[i]);
+            keep(in.vectorOut[0]);
+        });
+        add("QuaternionBatch::rotate (1 q)", true, [&in]() {
+            math::QuaternionBatch<T>::rotate(in.quaternionsA[0], in.vectorArray, in.vectorArrayOut);
+            keep(in.vectorArrayOut.x[0]);
+        });
+        add("QuaternionBatch::rotate (q per vektor)", true, [&in]() {
+            math::QuaternionBatch<T>::rotate(in.quaternionArray, in.vectorArray, in.vectorArrayOut);
+            keep(in.vectorArrayOut.x[0]);
+        });
+        add("Quaternion::normalize", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) in.quaternionOut[i] = in.quaternionsB[i].normalize();
+            keep(in.quaternionOut[0]);
+        });
+        add("QuaternionBatch::normalize", true, [&in]() {
+            // in-place; isinya sudah unit jadi hasilnya tetap, tapi kerjanya sama
+            math::QuaternionBatch<T>::normalize(in.quaternionArrayOut);
+            keep(in.quaternionArrayOut.w[0]);
+        });
+
+        // --- Matrix4 ---
+        add("Matrix4::fromQuaternion", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) in.matrixOut[i] = Matrix4<T>::fromQuaternion(in.quaternionsA[i]);
+            keep(in.matrixOut[0]);
+        });
+        add("QuaternionBatch::toMatrices", true, [&in]() {
+            math::QuaternionBatch<T>::toMatrices(in.quaternionArray, in.matrixOut);
+            keep(in.matrixOut[0]);
+        });
+        add("Matrix4::operator* (rotasi)", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) in.matrixOut[i] = in.rotations[i] * in.rotations[n - 1 - i];
+            keep(in.matrixOut[0]);
+        });
+        add("Matrix4::operator* (proyeksi)", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) in.matrixOut[i] = in.projectives[i] * in.rigids[n - 1 - i];
+            keep(in.matrixOut[0]);
+        });
+        add("Matrix4::operator* (Vector4)", false, [&in, n]() {
+            const Matrix4<T>& m = in.projectives[0];
+            for (size_t i = 0; i < n; ++i) in.pointOut[i] = m * in.points[i];
+            keep(in.pointOut[0]);
+        });
+        add("Matrix4::transformBatch", true, [&in, n]() {
+            in.projectives[0].transformBatch(in.points.data(), in.pointOut.data(), n);
+            keep(in.pointOut[0]);
+        });
+        add("Matrix4::inverse (rigid)", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) in.matrixOut[i] = in.rigids[i].inverse();
+            keep(in.matrixOut[0]);
+        });
+        add("Matrix4::inverse (umum)", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) in.matrixOut[i] = in.projectives[i].inverse();
+            keep(in.matrixOut[0]);
+        });
+        add("Matrix4::lookAt", false, [&in, n]() {
+            const Vector3<T> up(static_cast<T>(0), static_cast<T>(1), static_cast<T>(0));
+            for (size_t i = 0; i < n; ++i) in.matrixOut[i] = Matrix4<T>::lookAt(in.vectors[i], in.vectors[n - 1 - i], up);
+            keep(in.matrixOut[0]);
+        });
+        add("Matrix4::perspective", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) {
+                T fov = static_cast<T>(0.9) + in.scalars[i] * static_cast<T>(0.1);
+                in.matrixOut[i] = Matrix4<T>::perspective(fov, static_cast<T>(1.6), static_cast<T>(0.1), static_cast<T>(100));
+            }
+            keep(in.matrixOut[0]);
+        });
+
+        // --- Euler / Tait-Bryan ---
+        add("EulerAngles::fromZYX", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) {
+                const Vector3<T>& a = in.angles[i];
+                in.matrixOut[i] = math::EulerAngles<T>::fromZYX(a.x, a.y, a.z);
+            }
+            keep(in.matrixOut[0]);
+        });
+        add("EulerAngles::fromZYX", true, [&in]() {
+            math::EulerAngles<T>::fromZYX(in.angles, in.matrixOut);
+            keep(in.matrixOut[0]);
+        });
+        add("TaitBryanAngles::fromYawPitchRoll", false, [&in, n]() {
+            for (size_t i = 0; i < n; ++i) {
+                const Vector3<T>& a = in.angles[i];
+                in.matrixOut[i] = math::TaitBryanAngles<T>::fromYawPitchRoll(a.x, a.y, a.z);
+            }
+            keep(in.matrixOut[0]);
+        });
+        add("TaitBryanAngles::fromYawPitchRoll", true, [&in]() {
+            math::TaitBryanAngles<T>::fromYawPitchRoll(in.angles, in.matrixOut);
+            keep(in.matrixOut[0]);
+        });
+    }
+
+    double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    Measurement measure(const Case& benchmark, const Options& options) {
+        // warmup
+        Clock::time_point start = Clock::now();
+        do {
+            benchmark.call();
+        } while (secondsSince(start) < options.warmupSeconds);
+
+        // kalibrasi: gandakan jumlah panggilan sampai satu sampel cukup panjang buat resolusi timer
+        uint64_t calls = 1;
+        while (true) {
+            start = Clock::now();
+            for (uint64_t i = 0; i < calls; ++i) benchmark.call();
+            double elapsed = secondsSince(start);
+            if (elapsed >= options.sampleSeconds) break;
+            calls *= elapsed * 4 < options.sampleSeconds ? 4 : 2;
+        }
+
+        std::vector<double> samples;
+        for (int repetition = 0; repetition < options.repetitions; ++repetition) {
+            start = Clock::now();
+            for (uint64_t i = 0; i < calls; ++i) benchmark.call();
+            samples.push_back(secondsSince(start) * 1e9 / static_cast<double>(calls * ELEMENT_COUNT));
+        }
+
+        std::sort(samples.begin(), samples.end());
+        double median = samples[samples.size() / 2];
+        std::vector<double> deviations;
+        for (double sample : samples) deviations.push_back(std::abs(sample - median));
+        std::sort(deviations.begin(), deviations.end());
+        return {median, samples.front(), median > 0 ? deviations[deviations.size() / 2] / median : 0.0};
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--quick") {
+                // cukup buat CI: ~0.1 detik per kasus
+                options.warmupSeconds = 0.02;
+                options.sampleSeconds = 0.005;
+                options.repetitions = 7;
+            } else if (arg == "--filter" && hasValue) {
+                options.filter = argv[++i];
+            } else if (arg == "--cpu" && hasValue) {
+                options.cpu = std::stoi(argv[++i]);
+            } else if (arg == "--repetitions" && hasValue) {
+                options.repetitions = std::max(1, std::stoi(argv[++i]));
+            } else if (arg == "--warmup" && hasValue) {
+                options.warmupSeconds = std::stod(argv[++i]);
+            } else if (arg == "--sample" && hasValue) {
+                options.sampleSeconds = std::stod(argv[++i]);
+            } else if (arg == "--csv" && hasValue) {
+                options.csvPath = argv[++i];
+            } else {
+                printUsage(argv[0]);
+                return arg == "-h" || arg == "--help" ? 0 : 1;
+            }
+        }
+    } catch (const std::exception&) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    int pinnedCpu = pinToCpu(options.cpu);
+    if (pinnedCpu < 0) {
+        std::cerr << "Peringatan: gagal mengunci ke satu CPU, hasil bisa lebih noisy." << std::endl;
+    }
+
+    Inputs<float> floatInputs;
+    Inputs<double> doubleInputs;
+    std::vector<Case> cases;
+    addCases<float>("float", floatInputs, cases);
+    addCases<double>("double", doubleInputs, cases);
+
+    std::cout << "CPU " << pinnedCpu << ", " << ELEMENT_COUNT << " elemen per panggilan, median dari " << options.repetitions
+              << " sampel\nkernel float: Matrix4 " << Matrix4<float>::kernels().name << ", Quaternion "
+              << Quaternion<float>::kernels().name << ", batch " << math::QuaternionBatch<float>::kernels().name
+              << ", trig " << math::FastTrig<float>::kernels().name << "\nkernel double: Matrix4 "
+              << Matrix4<double>::kernels().name << ", Quaternion " << Quaternion<double>::kernels().name << ", batch "
+              << math::QuaternionBatch<double>::kernels().name << ", trig " << math::FastTrig<double>::kernels().name
+              << "\n\n";
+    std::cout << std::left << std::setw(42) << "operasi" << std::setw(8) << "tipe" << std::setw(8) << "mode" << std::right
+              << std::setw(12) << "ns/op" << std::setw(12) << "min" << std::setw(14) << "Mops/s" << std::setw(10) << "sebaran"
+              << std::endl;
+
+    std::ofstream csv;
+    if (!options.csvPath.empty()) {
+        csv.open(options.csvPath);
+        if (!csv) {
+            std::cerr << "Gagal menulis CSV: " << options.csvPath << std::endl;
+            return 1;
+        }
+        csv << "operation,type,mode,ns_per_op,min_ns_per_op,ops_per_sec,spread\n";
+    }
+
+    for (const Case& benchmark : cases) {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) continue;
+        Measurement result = measure(benchmark, options);
+        double opsPerSecond = 1e9 / result.nanosecondsPerOp;
+        const char* mode = benchmark.batch ? "batch" : "scalar";
+
+        std::cout << std::left << std::setw(42) << benchmark.name << std::setw(8) << benchmark.type << std::setw(8) << mode
+                  << std::right << std::fixed << std::setprecision(2) << std::setw(12) << result.nanosecondsPerOp
+                  << std::setw(12) << result.minimumNanosecondsPerOp << std::setw(14) << opsPerSecond / 1e6
+                  << std::setprecision(1) << std::setw(9) << result.spread * 100 << "%" << std::endl;
+        if (csv) {
+            csv << '"' << benchmark.name << "\"," << benchmark.type << "," << mode << "," << result.nanosecondsPerOp << ","
+                << result.minimumNanosecondsPerOp << "," << opsPerSecond << "," << result.spread << "\n";
+        }
+    }
+    return 0;
+}
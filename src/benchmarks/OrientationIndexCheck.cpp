@@ -0,0 +1,112 @@
+// OrientationIndexCheck.cpp
+// Cek skala jarak math::OrientationIndex: angleBetween harus sama dengan sudut rotasi 2 * acos(|a . b|), dan
+// nearest / withinAngle harus memberi orientasi & sudut yang sama dengan pencarian brute force pakai rumus itu.
+// Dihitung di double; acos dibandingkan cuma di luar daerah |a . b| ~ 1 yang memang nggak presisi.
+// Exit code 1 kalau ada yang beda
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "../modules/math/OrientationIndex.hpp"
+#include "../modules/math/Quaternion.hpp"
+#include "../modules/math/Vector3.hpp"
+
+namespace {
+    using math::OrientationIndex;
+    using math::Quaternion;
+
+    constexpr size_t LIBRARY_SIZE = 5000;
+    constexpr size_t QUERY_COUNT = 200;
+    constexpr size_t NEIGHBOR_COUNT = 8;
+    constexpr double MAX_ANGLE = 0.6; // radian, buat withinAngle
+
+    // xorshift64, deterministik supaya hasilnya bisa diulang
+    class Random {
+    public:
+        double uniform() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return static_cast<double>(state >> 11) / static_cast<double>(1ull << 53);
+        }
+
+    private:
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+    };
+
+    // seragam di S^3: titik acak di bola 4D lalu diproyeksikan ke permukaannya
+    Quaternion<double> randomOrientation(Random& random) {
+        double w, x, y, z, lengthSquared;
+        do {
+            w = random.uniform() * 2 - 1;
+            x = random.uniform() * 2 - 1;
+            y = random.uniform() * 2 - 1;
+            z = random.uniform() * 2 - 1;
+            lengthSquared = w * w + x * x + y * y + z * z;
+        } while (lengthSquared < 1e-4 || lengthSquared > 1);
+        double inverseLength = 1.0 / std::sqrt(lengthSquared);
+        return Quaternion<double>(w * inverseLength, x * inverseLength, y * inverseLength, z * inverseLength);
+    }
+
+    double referenceAngle(const Quaternion<double>& a, const Quaternion<double>& b) {
+        return 2.0 * std::acos(std::min(1.0, std::fabs(a.dot(b))));
+    }
+
+    bool report(const char* label, double deviation, double tolerance) {
+        bool passed = deviation <= tolerance;
+        std::cout << label << ": deviasi maks " << deviation << " rad (toleransi " << tolerance << ")"
+                  << (passed ? "  OK" : "  GAGAL") << std::endl;
+        return passed;
+    }
+}
+
+int main() {
+    Random random;
+    std::vector<Quaternion<double>> library(LIBRARY_SIZE);
+    for (Quaternion<double>& q : library) q = randomOrientation(random);
+    OrientationIndex<double> index(library);
+    bool passed = true;
+
+    // kasus yang gampang dicek manual: 1 rad di sumbu z
+    Quaternion<double> oneRadian = Quaternion<double>::fromAxisAngle(math::Vector3<double>(0, 0, 1), 1.0);
+    passed = report("1 rad di sumbu z", std::fabs(OrientationIndex<double>::angleBetween(Quaternion<double>(), oneRadian) - 1.0), 1e-12) && passed;
+
+    double angleDeviation = 0.0;
+    double nearestDeviation = 0.0;
+    bool withinMatches = true;
+    for (size_t i = 0; i < QUERY_COUNT; ++i) {
+        Quaternion<double> query = randomOrientation(random);
+
+        std::vector<double> bruteAngles(LIBRARY_SIZE);
+        for (size_t j = 0; j < LIBRARY_SIZE; ++j) {
+            bruteAngles[j] = referenceAngle(query, library[j]);
+            if (std::fabs(query.dot(library[j])) < 0.999) {
+                angleDeviation = std::max(angleDeviation, std::fabs(OrientationIndex<double>::angleBetween(query, library[j]) - bruteAngles[j]));
+            }
+        }
+
+        std::vector<double> sorted = bruteAngles;
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<OrientationIndex<double>::Neighbor> nearest = index.nearest(query, NEIGHBOR_COUNT);
+        for (size_t k = 0; k < nearest.size(); ++k) {
+            nearestDeviation = std::max(nearestDeviation, std::fabs(nearest[k].angle - sorted[k]));
+            nearestDeviation = std::max(nearestDeviation, std::fabs(nearest[k].angle - bruteAngles[nearest[k].index]));
+        }
+        withinMatches = withinMatches && nearest.size() == NEIGHBOR_COUNT;
+
+        // orientasi yang tepat di batas bisa jatuh ke sisi mana saja karena pembulatan, jadi dibandingkan dengan
+        // rentang hitungan brute force di batas ± 1e-9
+        size_t within = index.withinAngle(query, MAX_ANGLE).size();
+        size_t inner = static_cast<size_t>(std::upper_bound(sorted.begin(), sorted.end(), MAX_ANGLE - 1e-9) - sorted.begin());
+        size_t outer = static_cast<size_t>(std::upper_bound(sorted.begin(), sorted.end(), MAX_ANGLE + 1e-9) - sorted.begin());
+        withinMatches = withinMatches && within >= inner && within <= outer;
+    }
+
+    passed = report("angleBetween vs 2 * acos(|a . b|)", angleDeviation, 1e-9) && passed;
+    passed = report("nearest vs brute force", nearestDeviation, 1e-9) && passed;
+    std::cout << "withinAngle(" << MAX_ANGLE << " rad) vs brute force: " << (withinMatches ? "sama  OK" : "beda  GAGAL") << std::endl;
+    passed = withinMatches && passed;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,227 @@
+// RotationStackCheck.cpp
+// Cek math::RotationStack (treap implisit) terhadap model naif std::vector<Quaternion>: operasi acak sisip/hapus/ganti
+// di posisi acak, dan sesudah tiap operasi product(), prefixProduct(k) acak dan get(i) acak dibandingkan dengan hasil
+// kali urut vektor yang dihitung di long double dari langkah yang sama. Yang dilaporkan deviasi komponen maksimum
+// (q dan -q dianggap sama); exit code 1 kalau lewat toleransi atau isi stack beda dengan vektor.
+//
+// Sesudah itu diukur biaya set() dan erase + insert di stack float berukuran --size (default 100k langkah)
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../modules/math/Quaternion.hpp"
+#include "../modules/math/RotationStack.hpp"
+
+namespace {
+    using math::Quaternion;
+    using math::RotationStack;
+    using Exact = long double;
+
+    struct Options {
+        uint64_t operations = 20000;
+        size_t maxSteps = 512;      // ukuran stack di tes acak dijaga di bawah ini supaya model naif tetap murah
+        size_t timingSteps = 100000;
+        uint64_t timingOperations = 100000;
+    };
+
+    void printUsage(const char* programName) {
+        std::cout << "Pemakaian: " << programName << " [--ops N=2e4] [--max-steps N=512] [--size N=1e5] [--timing-ops N=1e5]"
+                  << std::endl;
+    }
+
+    // xorshift64, deterministik supaya hasilnya bisa diulang
+    class Random {
+    public:
+        uint64_t next() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+
+        // [0, bound)
+        size_t index(size_t bound) { return static_cast<size_t>(next() % bound); }
+
+        double uniform() { return static_cast<double>(next() >> 11) / static_cast<double>(1ull << 53); }
+
+    private:
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+    };
+
+    // rotasi acak sampai 180 derajat di sumbu acak; sengaja nggak persis unit supaya normalisasi di insert ikut dicek
+    template<typename T>
+    Quaternion<T> randomStep(Random& random) {
+        double x, y, z, lengthSquared;
+        do {
+            x = random.uniform() * 2 - 1;
+            y = random.uniform() * 2 - 1;
+            z = random.uniform() * 2 - 1;
+            lengthSquared = x * x + y * y + z * z;
+        } while (lengthSquared < 1e-4 || lengthSquared > 1);
+        double halfAngle = random.uniform() * 3.14159265358979323846 / 2;
+        double length = 0.5 + random.uniform();
+        double scale = length * std::sin(halfAngle) / std::sqrt(lengthSquared);
+        return Quaternion<T>(static_cast<T>(length * std::cos(halfAngle)),
+                             static_cast<T>(x * scale), static_cast<T>(y * scale), static_cast<T>(z * scale));
+    }
+
+    template<typename T>
+    Quaternion<Exact> lift(const Quaternion<T>& q) {
+        return Quaternion<Exact>(q.w, q.x, q.y, q.z);
+    }
+
+    // hasil kali s0 * ... * s(count-1) dari langkah yang sudah dinormalisasi, dinormalisasi di akhir
+    template<typename T>
+    Quaternion<Exact> naivePrefix(const std::vector<Quaternion<T>>& steps, size_t count) {
+        Quaternion<Exact> result;
+        for (size_t i = 0; i < count; ++i) result = result * lift(steps[i]);
+        return result.normalize();
+    }
+
+    template<typename T>
+    Exact deviation(const Quaternion<T>& q, const Quaternion<Exact>& reference) {
+        Quaternion<Exact> a = lift(q);
+        Exact same = std::max({std::fabs(a.w - reference.w), std::fabs(a.x - reference.x),
+                               std::fabs(a.y - reference.y), std::fabs(a.z - reference.z)});
+        Exact flipped = std::max({std::fabs(a.w + reference.w), std::fabs(a.x + reference.x),
+                                  std::fabs(a.y + reference.y), std::fabs(a.z + reference.z)});
+        return std::min(same, flipped);
+    }
+
+    template<typename T>
+    bool runRandomCheck(const char* type, const Options& options, Exact tolerance) {
+        RotationStack<T> stack;
+        std::vector<Quaternion<T>> model;
+        Random random;
+        Exact maxProductDeviation = 0;
+        Exact maxPrefixDeviation = 0;
+        uint64_t inserts = 0, erases = 0, sets = 0;
+        bool stepsMatch = true;
+
+        for (uint64_t op = 0; op < options.operations; ++op) {
+            // condong ke sisip waktu stack kecil, ke hapus waktu mendekati batas
+            double growth = 1.0 - static_cast<double>(model.size()) / static_cast<double>(options.maxSteps);
+            double choice = random.uniform();
+            if (model.empty() || (choice < 0.5 * growth + 0.1 && model.size() < options.maxSteps)) {
+                size_t index = random.index(model.size() + 1);
+                Quaternion<T> step = randomStep<T>(random);
+                stack.insert(index, step);
+                model.insert(model.begin() + static_cast<std::ptrdiff_t>(index), step.normalize());
+                ++inserts;
+            } else if (choice < 0.7) {
+                size_t index = random.index(model.size());
+                stack.erase(index);
+                model.erase(model.begin() + static_cast<std::ptrdiff_t>(index));
+                ++erases;
+            } else {
+                size_t index = random.index(model.size());
+                Quaternion<T> step = randomStep<T>(random);
+                stack.set(index, step);
+                model[index] = step.normalize();
+                ++sets;
+            }
+
+            if (stack.size() != model.size()) {
+                std::cerr << type << ": ukuran beda di operasi " << op << " (" << stack.size() << " vs " << model.size() << ")" << std::endl;
+                return false;
+            }
+            maxProductDeviation = std::max(maxProductDeviation, deviation(stack.product(), naivePrefix(model, model.size())));
+            size_t count = random.index(model.size() + 1);
+            maxPrefixDeviation = std::max(maxPrefixDeviation, deviation(stack.prefixProduct(count), naivePrefix(model, count)));
+            if (!model.empty()) {
+                size_t index = random.index(model.size());
+                const Quaternion<T>& step = stack.get(index);
+                const Quaternion<T>& expected = model[index];
+                stepsMatch = stepsMatch && step.w == expected.w && step.x == expected.x && step.y == expected.y && step.z == expected.z;
+            }
+        }
+        stepsMatch = stepsMatch && stack.toVector().size() == model.size();
+
+        bool passed = stepsMatch && maxProductDeviation <= tolerance && maxPrefixDeviation <= tolerance;
+        std::cout << type << ": " << options.operations << " operasi (" << inserts << " sisip, " << erases << " hapus, "
+                  << sets << " ganti), deviasi maks product " << static_cast<double>(maxProductDeviation)
+                  << ", prefixProduct " << static_cast<double>(maxPrefixDeviation) << " (toleransi "
+                  << static_cast<double>(tolerance) << ")" << (stepsMatch ? "" : ", langkah tersimpan beda")
+                  << (passed ? "  OK" : "  GAGAL") << std::endl;
+        return passed;
+    }
+
+    void runTiming(const Options& options) {
+        using Clock = std::chrono::steady_clock;
+        Random random;
+        RotationStack<float> stack;
+        for (size_t i = 0; i < options.timingSteps; ++i) stack.pushBack(randomStep<float>(random));
+
+        std::vector<size_t> indices(options.timingOperations);
+        std::vector<Quaternion<float>> steps(options.timingOperations);
+        for (uint64_t i = 0; i < options.timingOperations; ++i) {
+            indices[i] = random.index(options.timingSteps);
+            steps[i] = randomStep<float>(random);
+        }
+
+        // product() dibaca tiap operasi supaya kerjanya nggak dibuang compiler
+        float sink = 0.0f;
+        auto start = Clock::now();
+        for (uint64_t i = 0; i < options.timingOperations; ++i) {
+            stack.set(indices[i], steps[i]);
+            sink += stack.product().w;
+        }
+        double setSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        start = Clock::now();
+        for (uint64_t i = 0; i < options.timingOperations; ++i) {
+            stack.erase(indices[i]);
+            stack.insert(indices[i], steps[i]);
+            sink += stack.product().w;
+        }
+        double moveSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        double perOperation = 1e9 / static_cast<double>(options.timingOperations);
+        std::cout << "float, " << options.timingSteps << " langkah: set " << setSeconds * perOperation << " ns/op, erase + insert "
+                  << moveSeconds * perOperation << " ns/op (checksum " << sink << ")" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--ops" && hasValue) {
+                double operations = std::stod(argv[++i]);
+                if (!(operations >= 1)) throw std::invalid_argument("ops");
+                options.operations = static_cast<uint64_t>(operations);
+            } else if (arg == "--max-steps" && hasValue) {
+                double steps = std::stod(argv[++i]);
+                if (!(steps >= 1)) throw std::invalid_argument("max-steps");
+                options.maxSteps = static_cast<size_t>(steps);
+            } else if (arg == "--size" && hasValue) {
+                double steps = std::stod(argv[++i]);
+                if (!(steps >= 1)) throw std::invalid_argument("size");
+                options.timingSteps = static_cast<size_t>(steps);
+            } else if (arg == "--timing-ops" && hasValue) {
+                double operations = std::stod(argv[++i]);
+                if (!(operations >= 1)) throw std::invalid_argument("timing-ops");
+                options.timingOperations = static_cast<uint64_t>(operations);
+            } else {
+                printUsage(argv[0]);
+                return arg == "-h" || arg == "--help" ? 0 : 1;
+            }
+        }
+    } catch (const std::exception&) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // error treap ~ kedalaman tree x epsilon; toleransinya longgar dibanding itu tapi jauh di bawah error yang kelihatan
+    bool passed = runRandomCheck<double>("double", options, 1e-12L);
+    passed = runRandomCheck<float>("float", options, 1e-4L) && passed;
+    runTiming(options);
+    return passed ? 0 : 1;
+}
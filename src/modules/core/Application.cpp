@@ -3,10 +3,19 @@
 #include <iostream>
 #include <SDL_ttf.h>
 #include <vector>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <chrono>
+#include <fstream>
 
 #include "../graphics/Camera.hpp"
 #include "../graphics/Renderer.hpp"
-#include "../graphics/ObjLoader.hpp"
+#include "../graphics/MeshWelder.hpp"
+#include "../graphics/MeshQuantizer.hpp"
+#include "../graphics/MeshLoader.hpp"
+#include "../graphics/MeshCache.hpp"
 #include "../graphics/Mesh.hpp"
 #include "../math/Matrix4.hpp"
 #include "../math/Vector3.hpp"
@@ -20,6 +29,25 @@ namespace app {
     using Vector3f = math::Vector3<float>;
     using Matrix4f = math::Matrix4<float>;
 
+    namespace {
+        // warna bucket ke-index dari count, keliling roda hue (HSV, s = 0.6, v = 1)
+        void hueColor(size_t index, size_t count, Uint8& r, Uint8& g, Uint8& b) {
+            float hue = 6.0f * static_cast<float>(index) / static_cast<float>(count);
+            float fraction = hue - std::floor(hue);
+            Uint8 high = 255, low = 102;
+            Uint8 falling = static_cast<Uint8>(high - (high - low) * fraction);
+            Uint8 rising = static_cast<Uint8>(low + (high - low) * fraction);
+            switch (static_cast<int>(hue) % 6) {
+                case 0: r = high; g = rising; b = low; break;
+                case 1: r = falling; g = high; b = low; break;
+                case 2: r = low; g = high; b = rising; break;
+                case 3: r = low; g = falling; b = high; break;
+                case 4: r = rising; g = low; b = high; break;
+                default: r = high; g = low; b = falling; break;
+            }
+        }
+    }
+
     Application::Application() : quit(false), rotationAngle(0.0f) {
         if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS) < 0) {
             std::cerr << "SDL tidak dapat diinisialisasi! SDL_Error: " << SDL_GetError() << std::endl;
@@ -46,10 +74,19 @@ namespace app {
             mainWindow->getHeight()
         );
         
+        meshCache = std::make_unique<graphics::MeshCache<float>>(
+            MESH_CACHE_CAPACITY_BYTES,
+            [this](const std::string& filename) { return loadMesh(filename); }
+        );
+        
         uiManager->onFileSelected = [this](const std::string& filename) {
             onFileSelected(filename);
         };
         
+        uiManager->onFitTargetSelected = [this](const std::string& filename) {
+            onFitTargetSelected(filename);
+        };
+        
         uiManager->onApplyRotation = [this]() {
             onApplyRotation();
         };
@@ -57,9 +94,22 @@ namespace app {
         uiManager->onResetRotation = [this]() {
             onResetRotation();
         };
+
+        uiManager->onInsertStackStep = [this]() { onInsertStackStep(); };
+        uiManager->onReplaceStackStep = [this]() { onReplaceStackStep(); };
+        uiManager->onRemoveStackStep = [this]() { onRemoveStackStep(); };
+        uiManager->onStackSelectionChanged = [this]() { refreshRotationStack(uiManager->getSelectedStackStep()); };
+        uiManager->onSpinToggled = [this](bool enabled) {
+            if (enabled) startSpin();
+            else stopSpin(true);
+        };
+        uiManager->onCompareViewToggled = [this](bool enabled) { onCompareViewToggled(enabled); };
         
         originalModelMatrix = Matrix4f::identity();
         rotatedModelMatrix = Matrix4f::identity();
+
+        workerPool = std::make_unique<ThreadPool>();
+        loadOrientationLibrary(ORIENTATION_LIBRARY_PATH);
     }
 
     Application::~Application() {
@@ -119,7 +169,7 @@ namespace app {
                 float yoffset = static_cast<float>(prevY - mouseY);
                 prevX = mouseX;
                 prevY = mouseY;
-                mainCamera->handleMouseMovement(xoffset, yoffset);
+                activeCamera()->handleMouseMovement(xoffset, yoffset);
             }
         }
     }
@@ -240,12 +290,511 @@ namespace app {
     
     void Application::update(float deltaTime) {
         const Uint8* state = SDL_GetKeyboardState(NULL);
-        mainCamera->handleKeyboard(state, deltaTime);
+        activeCamera()->handleKeyboard(state, deltaTime);
         uiManager->update(deltaTime);
+
+        if (spinning) {
+            updateSpin(deltaTime);
+        } else if (animating) {
+            animationTime += deltaTime;
+            if (animationTime >= rotationTrack.getEndTime()) {
+                // pose akhir diambil persis dari hasil kali stack, bukan dari hasil interpolasi
+                rotatedModelMatrix = targetModelMatrix;
+                animating = false;
+            } else {
+                rotatedModelMatrix = Matrix4f::fromQuaternion(rotationTrack.sample(animationTime));
+            }
+        }
+
+        if (uiManager->isGimbalExplorerEnabled()) {
+            updateGimbalSweep();
+        }
+        updateNearestOrientation();
+        if (uiManager->getS3ViewMode() != ui::S3ViewMode::OFF) {
+            updateS3Cloud();
+        }
+    }
+
+    bool Application::S3CloudKey::operator==(const S3CloudKey& other) const {
+        if (mode != other.mode || sampleSet != other.sampleSet || count != other.count || radius != other.radius
+            || stack.size() != other.stack.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < stack.size(); ++i) {
+            const Quaternionf& a = stack[i];
+            const Quaternionf& b = other.stack[i];
+            if (a.w != b.w || a.x != b.x || a.y != b.y || a.z != b.z) return false;
+        }
+        return true;
+    }
+
+    void Application::updateS3Cloud() {
+        S3CloudKey key;
+        key.mode = uiManager->getS3ViewMode();
+        key.sampleSet = uiManager->getS3SampleSet();
+        key.count = uiManager->getS3PointCount();
+        key.radius = key.sampleSet == ui::S3SampleSet::NEAR_POSE ? uiManager->getS3NearRadius() : 0.0f;
+        for (size_t i = 0; i < rotationStack.size(); ++i) key.stack.push_back(rotationStack.get(i));
+        if (s3CloudValid && key == s3CloudKey) return;
+        s3CloudKey = key;
+        s3CloudValid = true;
+
+        using Projection = math::S3Projection<float>;
+        auto start = std::chrono::steady_clock::now();
+        const uint64_t seed = 0x5EED5EEDull;
+        Quaternionf pose = rotationStack.product();
+        size_t count = key.count;
+
+        math::RotationTrack<float> trajectory;
+        if (key.sampleSet == ui::S3SampleSet::TRAJECTORY) {
+            buildStackPath(trajectory); // sudah di-prepare, jadi aman dibaca paralel
+            if (rotationStack.empty()) count = 0;
+        }
+
+        s3Samples.resize(count);
+        s3Positions.resize(count);
+        std::vector<uint8_t> buckets(count, 0);
+        const bool hopf = key.mode == ui::S3ViewMode::HOPF;
+        const float radiusRadians = key.radius * (3.141592653589793f / 180.0f);
+        workerPool->parallelFor(count, Projection::CHUNK_SIZE, [&](size_t begin, size_t end) {
+            math::simd::QuaternionView<float> samples = s3Samples.view();
+            switch (key.sampleSet) {
+                case ui::S3SampleSet::NEAR_POSE:
+                    Projection::sampleNearRange(pose, radiusRadians, samples, seed, begin, end);
+                    break;
+                case ui::S3SampleSet::TRAJECTORY: {
+                    float scale = count > 1 ? trajectory.getEndTime() / static_cast<float>(count - 1) : 0.0f;
+                    for (size_t i = begin; i < end; ++i) s3Samples.set(i, trajectory.sample(scale * static_cast<float>(i)));
+                    break;
+                }
+                case ui::S3SampleSet::UNIFORM:
+                default:
+                    Projection::sampleUniformRange(samples, seed, begin, end);
+                    break;
+            }
+            const math::QuaternionArray<float>& constSamples = s3Samples;
+            Projection::stereographicRange(constSamples.view(), s3Positions.data(), S3_CLOUD_RADIUS, begin, end);
+            if (hopf) Projection::hopfBucketRange(constSamples.view(), buckets.data(), S3_HOPF_BUCKETS, begin, end);
+        });
+
+        // counting sort per warna, lalu potongan yang nggak melewati batas warna
+        s3Chunks.clear();
+        size_t bucketCount = hopf ? S3_HOPF_BUCKETS : 1;
+        std::vector<size_t> offsets(bucketCount + 1, 0);
+        for (uint8_t bucket : buckets) ++offsets[bucket + 1];
+        for (size_t k = 0; k < bucketCount; ++k) offsets[k + 1] += offsets[k];
+        if (hopf) {
+            std::vector<Vector3f> sorted(count);
+            std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < count; ++i) sorted[cursor[buckets[i]]++] = s3Positions[i];
+            s3Positions.swap(sorted);
+        }
+        for (size_t k = 0; k < bucketCount; ++k) {
+            for (size_t begin = offsets[k]; begin < offsets[k + 1]; begin += Projection::CHUNK_SIZE) {
+                s3Chunks.push_back({begin, std::min(offsets[k + 1], begin + Projection::CHUNK_SIZE), static_cast<uint8_t>(k)});
+            }
+        }
+        s3ScreenPoints.resize(count);
+        s3VisibleCounts.assign(s3Chunks.size(), 0);
+
+        // fiber: satu per warna (titik dasar di lintang 30°, azimuth di tengah bucket) + fiber pose sekarang
+        s3Fibers.clear();
+        if (hopf) {
+            std::vector<Quaternionf> fiber;
+            auto addFiber = [&](const Quaternionf& q) {
+                Projection::fiber(q, S3_FIBER_SEGMENTS, fiber);
+                std::vector<Vector3f> points(fiber.size());
+                for (size_t i = 0; i < fiber.size(); ++i) points[i] = Projection::stereographic(fiber[i]) * S3_CLOUD_RADIUS;
+                s3Fibers.push_back(std::move(points));
+            };
+            const float latitude = 30.0f * (3.141592653589793f / 180.0f);
+            for (size_t k = 0; k < S3_HOPF_BUCKETS; ++k) {
+                float azimuth = 6.283185307179586f * (static_cast<float>(k) + 0.5f) / static_cast<float>(S3_HOPF_BUCKETS)
+                              - 3.141592653589793f;
+                Vector3f base(std::cos(azimuth) * std::cos(latitude), std::sin(azimuth) * std::cos(latitude), std::sin(latitude));
+                addFiber(Projection::baseRotation(base));
+            }
+            addFiber(pose);
+        }
+
+        double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::ostringstream status;
+        if (count == 0) status << "Stack kosong, belum ada trajektori";
+        else status << count << " titik, sampel " << std::fixed << std::setprecision(1) << elapsedMs << " ms";
+        uiManager->setS3ViewStatus(status.str());
+    }
+
+    // file nggak ada = library kosong (fiturnya diam saja); baris yang rusak dilewati
+    void Application::loadOrientationLibrary(const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file.is_open()) return;
+
+        std::vector<Quaternionf> orientations;
+        std::string line;
+        size_t lineNumber = 0;
+        while (std::getline(file, line)) {
+            ++lineNumber;
+            size_t first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#') continue;
+
+            std::istringstream stream(line);
+            float w, x, y, z;
+            if (!(stream >> w >> x >> y >> z) || !(w * w + x * x + y * y + z * z > 0.0f)) {
+                std::cerr << "Library orientasi " << filename << ":" << lineNumber << " bukan \"w x y z [nama]\", dilewati" << std::endl;
+                continue;
+            }
+            std::string name;
+            std::getline(stream >> std::ws, name);
+            if (!name.empty() && name.back() == '\r') name.pop_back();
+            orientations.push_back(Quaternionf(w, x, y, z));
+            orientationNames.push_back(name.empty() ? "#" + std::to_string(orientations.size()) : name);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        orientationIndex.build(orientations);
+        double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Library orientasi: " << orientationIndex.size() << " pose dari " << filename << " (index "
+                  << std::fixed << std::setprecision(1) << elapsedMs << " ms)" << std::endl;
+    }
+
+    // pose yang bakal dihasilkan Apply dengan sumbu/sudut di panel quaternion -> orientasi library terdekat.
+    // Query cuma diulang kalau pose-nya berubah
+    void Application::updateNearestOrientation() {
+        if (orientationIndex.empty() || uiManager->getRotationMethod() != ui::RotationMethod::QUATERNION) return;
+
+        float x, y, z;
+        uiManager->getRotationAxis(x, y, z);
+        float length = std::sqrt(x * x + y * y + z * z);
+        if (!(length > 0.0f)) {
+            uiManager->setNearestOrientation("", "");
+            orientationQueryValid = false;
+            return;
+        }
+        Vector3f axis(x / length, y / length, z / length);
+        Quaternionf step = Quaternionf::fromAxisAngle(axis, uiManager->getRotationAngle() * (3.141592653589793f / 180.0f));
+        Quaternionf query = rotationStack.product() * step;
+        if (orientationQueryValid && query.w == lastOrientationQuery.w && query.x == lastOrientationQuery.x
+            && query.y == lastOrientationQuery.y && query.z == lastOrientationQuery.z) {
+            return;
+        }
+        lastOrientationQuery = query;
+        orientationQueryValid = true;
+
+        const float toDegrees = 180.0f / 3.141592653589793f;
+        std::vector<math::OrientationIndex<float>::Neighbor> nearest = orientationIndex.nearest(query, 1);
+        size_t nearCount = orientationIndex.withinAngle(query, NEAR_ORIENTATION_DEGREES / toDegrees).size();
+
+        std::ostringstream nearestText, countText;
+        nearestText << std::fixed << std::setprecision(1) << "~ " << orientationNames[nearest[0].index] << " ("
+                    << nearest[0].angle * toDegrees << "°)";
+        countText << nearCount << " pose dalam " << std::setprecision(0) << std::fixed << NEAR_ORIENTATION_DEGREES << "°";
+        uiManager->setNearestOrientation(nearestText.str(), countText.str());
+    }
+
+    void Application::updateGimbalSweep() {
+        math::AxisOrder order = static_cast<math::AxisOrder>(uiManager->getGimbalAxisOrder());
+        int parameter = uiManager->getGimbalSweepParameter();
+        float first, second, third;
+        uiManager->getGimbalExplorerAngles(first, second, third);
+        Vector3f heldAngles(first, second, third);
+
+        if (gimbalSweepValid && gimbalSweep.order == order && gimbalSweep.parameter == parameter
+            && gimbalSweep.heldAngles == heldAngles) {
+            return;
+        }
+
+        gimbalSweep.order = order;
+        gimbalSweep.parameter = parameter;
+        gimbalSweep.heldAngles = heldAngles;
+        math::GimbalSweeper<float>::prepare(gimbalSweep, GIMBAL_SWEEP_SAMPLES);
+        workerPool->parallelFor(GIMBAL_SWEEP_SAMPLES, math::GimbalSweeper<float>::CHUNK_SIZE,
+            [this](size_t begin, size_t end) { math::GimbalSweeper<float>::computeRange(gimbalSweep, begin, end); });
+        gimbalSweepValid = true;
+
+        float minimum = std::numeric_limits<float>::infinity();
+        float minimumAngle = 0.0f;
+        size_t nearLock = 0;
+        for (size_t i = 0; i < gimbalSweep.size(); ++i) {
+            float condition = gimbalSweep.conditionNumbers[i];
+            if (condition < minimum) {
+                minimum = condition;
+                minimumAngle = gimbalSweep.angles[i];
+            }
+            if (condition > GIMBAL_LOCK_CONDITION) ++nearLock;
+        }
+
+        // kondisi di pose slider sendiri (sudut yang di-sweep juga diambil dari slider-nya)
+        math::GimbalSweep<float> pose;
+        pose.order = order;
+        pose.parameter = parameter;
+        pose.heldAngles = heldAngles;
+        pose.rangeStart = pose.rangeEnd = parameter == 0 ? first : (parameter == 1 ? second : third);
+        math::GimbalSweeper<float>::compute(pose, 1);
+
+        std::ostringstream line1, line2;
+        line1 << std::fixed << std::setprecision(2) << "Kondisi pose: ";
+        if (std::isinf(pose.conditionNumbers[0])) line1 << "inf (gimbal lock)";
+        else line1 << pose.conditionNumbers[0];
+        line2 << std::fixed << std::setprecision(1) << "Min " << minimum << " @ " << minimumAngle << "°, "
+              << 100.0f * static_cast<float>(nearLock) / static_cast<float>(gimbalSweep.size()) << "% > "
+              << GIMBAL_LOCK_CONDITION;
+        uiManager->setGimbalExplorerStatus(line1.str(), line2.str());
+    }
+
+    void Application::drawS3Cloud(const Matrix4f& viewProjectionMatrix) {
+        workerPool->parallelFor(s3Chunks.size(), 1, [this, &viewProjectionMatrix](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; ++c) {
+                const S3Chunk& chunk = s3Chunks[c];
+                s3VisibleCounts[c] = mainRenderer->projectPoints(s3Positions.data() + chunk.begin, chunk.end - chunk.begin,
+                                                                 viewProjectionMatrix, s3ScreenPoints.data() + chunk.begin);
+            }
+        });
+
+        bool hopf = s3CloudKey.mode == ui::S3ViewMode::HOPF;
+        for (size_t c = 0; c < s3Chunks.size(); ++c) {
+            Uint8 r = 90, g = 150, b = 220;
+            if (hopf) hueColor(s3Chunks[c].bucket, S3_HOPF_BUCKETS, r, g, b);
+            mainRenderer->drawScreenPoints(s3ScreenPoints.data() + s3Chunks[c].begin, s3VisibleCounts[c], r, g, b, 255);
+        }
+
+        for (size_t k = 0; k < s3Fibers.size(); ++k) {
+            Uint8 r = 255, g = 255, b = 255;
+            if (k + 1 < s3Fibers.size()) hueColor(k, S3_HOPF_BUCKETS, r, g, b);
+            drawS3Polyline(s3Fibers[k], viewProjectionMatrix, r, g, b);
+        }
+        if (!hopf) {
+            // pose sekarang: tanda silang kecil
+            Vector3f center = math::S3Projection<float>::stereographic(rotationStack.product()) * S3_CLOUD_RADIUS;
+            const float size = 0.08f;
+            for (int axis = 0; axis < 3; ++axis) {
+                Vector3f offset(axis == 0 ? size : 0.0f, axis == 1 ? size : 0.0f, axis == 2 ? size : 0.0f);
+                mainRenderer->drawLine(center - offset, center + offset, viewProjectionMatrix, 255, 255, 255, 255);
+            }
+        }
+    }
+
+    const graphics::Wireframe<float>& Application::currentWireframe() {
+        if (meshWireframeSource != mesh) {
+            meshWireframe = graphics::Wireframe<float>::build(*mesh);
+            meshWireframeSource = mesh;
+        }
+        return meshWireframe;
+    }
+
+    // tiap kali dinyalakan, kamera semua viewport mulai dari kamera utama; waktu dimatikan kameranya dibuang
+    void Application::onCompareViewToggled(bool enabled) {
+        if (enabled) {
+            compareCameras.assign(COMPARE_VIEWPORT_COUNT, *mainCamera);
+        } else {
+            compareCameras.clear();
+        }
+    }
+
+    // kamera yang menerima keyboard & mouse: kamera utama, atau di tampilan banding kamera viewport di bawah kursor.
+    // Cuma lookup; kamera banding disiapkan/dibuang di onCompareViewToggled
+    const graphics::Camera<float>* Application::activeCamera() const {
+        if (!uiManager->isCompareViewEnabled() || compareCameras.empty()) {
+            return mainCamera;
+        }
+        int mouseX = 0, mouseY = 0;
+        SDL_GetMouseState(&mouseX, &mouseY);
+        int viewport = std::clamp(mouseX * COMPARE_VIEWPORT_COUNT / std::max(1, mainWindow->getWidth()),
+                                  0, COMPARE_VIEWPORT_COUNT - 1);
+        return &compareCameras[viewport];
+    }
+
+    graphics::Camera<float>* Application::activeCamera() {
+        return const_cast<graphics::Camera<float>*>(static_cast<const Application*>(this)->activeCamera());
+    }
+
+    // langkah yang akan ditambahkan Apply kalau metode ini yang dipilih (tanpa keyframe/log seperti composeStepFromUI)
+    Quaternionf Application::previewStep(ui::RotationMethod method) const {
+        switch (method) {
+            case ui::RotationMethod::QUATERNION: {
+                float x, y, z;
+                uiManager->getRotationAxis(x, y, z);
+                Vector3f axis(x, y, z);
+                if (axis.length() == 0.0f) return Quaternionf();
+                return Quaternionf::fromAxisAngle(axis.normalize(), uiManager->getRotationAngle() * (3.141592653589793f / 180.0f));
+            }
+            case ui::RotationMethod::EULER_ANGLES: {
+                float alpha, beta, gamma;
+                uiManager->getEulerAngles(alpha, beta, gamma);
+                return math::EulerAngles<float>::toQuaternion(alpha, beta, gamma);
+            }
+            case ui::RotationMethod::TAIT_BRYAN:
+            default: {
+                float yaw, pitch, roll;
+                uiManager->getTaitBryanAngles(yaw, pitch, roll);
+                return math::TaitBryanAngles<float>::toQuaternion(yaw, pitch, roll);
+            }
+        }
+    }
+
+    // Tiga viewport berdampingan, viewport ke-i menonjolkan hasil metode ke-i (pose stack * langkah dari input
+    // panel metode itu) dan menampilkan dua metode lain redup sebagai pembanding. Pose per metode cuma diubah ke
+    // matriks sekali per frame, topologi wireframe dipakai bersama semua viewport, dan tiap viewport menggambar
+    // keempat pose (asli + tiga metode) dalam satu drawWireframes. Label sumbu (teks dirender ulang tiap frame)
+    // dan overlay lain cuma ada di tampilan tunggal
+    void Application::renderComparison() {
+        if (compareCameras.size() != COMPARE_VIEWPORT_COUNT) return;
+
+        const char* names[COMPARE_VIEWPORT_COUNT] = {"Quaternion", "Euler Angles", "Tait-Bryan"};
+        const SDL_Color methodColors[COMPARE_VIEWPORT_COUNT] = {{200, 120, 255, 255}, {255, 170, 60, 255}, {80, 200, 255, 255}};
+        Quaternionf pose = rotationStack.product();
+        Quaternionf methodPoses[COMPARE_VIEWPORT_COUNT];
+        for (int i = 0; i < COMPARE_VIEWPORT_COUNT; ++i) {
+            methodPoses[i] = pose * previewStep(static_cast<ui::RotationMethod>(i));
+        }
+
+        // urutan gambar: asli, dua metode lain (redup), metode viewport ini paling atas
+        Matrix4f modelMatrices[COMPARE_VIEWPORT_COUNT + 1];
+        Matrix4f methodMatrices[COMPARE_VIEWPORT_COUNT];
+        for (int i = 0; i < COMPARE_VIEWPORT_COUNT; ++i) methodMatrices[i] = Matrix4f::fromQuaternion(methodPoses[i]);
+        SDL_Color colors[COMPARE_VIEWPORT_COUNT + 1];
+        modelMatrices[0] = originalModelMatrix;
+        colors[0] = {100, 100, 100, 255};
+
+        const bool hasMesh = mesh && !mesh->empty();
+        const int width = mainWindow->getWidth() / COMPARE_VIEWPORT_COUNT;
+        const int height = mainWindow->getHeight();
+        const float toDegrees = 180.0f / 3.141592653589793f;
+        for (int viewport = 0; viewport < COMPARE_VIEWPORT_COUNT; ++viewport) {
+            SDL_Rect rect = {viewport * width, 0, width, height};
+            mainRenderer->setViewport(&rect);
+            const graphics::Camera<float>& camera = compareCameras[viewport];
+            Matrix4f viewMatrix = camera.getViewMatrix();
+            Matrix4f projectionMatrix = camera.getProjectionMatrix(width, height);
+            mainRenderer->drawAxes(projectionMatrix * viewMatrix);
+
+            if (hasMesh) {
+                size_t count = 1;
+                for (int i = 0; i < COMPARE_VIEWPORT_COUNT; ++i) {
+                    if (i == viewport) continue;
+                    const SDL_Color& c = methodColors[i];
+                    modelMatrices[count] = methodMatrices[i];
+                    colors[count++] = {static_cast<Uint8>(c.r * 2 / 5), static_cast<Uint8>(c.g * 2 / 5), static_cast<Uint8>(c.b * 2 / 5), 255};
+                }
+                modelMatrices[count] = methodMatrices[viewport];
+                colors[count++] = methodColors[viewport];
+                mainRenderer->drawWireframes(*mesh, currentWireframe(), modelMatrices, colors, count, viewMatrix, projectionMatrix);
+            }
+
+            // viewport pertama ketutup panel kiri di bagian atasnya
+            const int textX = viewport == 0 ? 340 : 10;
+            const SDL_Color& c = methodColors[viewport];
+            mainRenderer->drawText(names[viewport], textX, 10, c.r, c.g, c.b, 255);
+            // selisih ke dua metode lain (sudut rotasi di antaranya)
+            std::ostringstream difference;
+            difference << std::fixed << std::setprecision(2);
+            for (int i = 0; i < COMPARE_VIEWPORT_COUNT; ++i) {
+                if (i == viewport) continue;
+                difference << names[i] << ": "
+                           << math::OrientationIndex<float>::angleBetween(methodPoses[viewport], methodPoses[i]) * toDegrees << "°  ";
+            }
+            mainRenderer->drawText(difference.str(), textX, 32, 180, 180, 180, 255);
+        }
+        mainRenderer->setViewport(nullptr);
+    }
+
+    // identitas -> pose sesudah tiap langkah (key ke-i di t = i), slerp per langkah; dipakai trajektori S^3 & ghost
+    void Application::buildStackPath(math::RotationTrack<float>& path) const {
+        path.clear();
+        path.setInterpolation(math::RotationInterpolation::SLERP);
+        path.addKey(0.0f, Quaternionf());
+        for (size_t i = 0; i < rotationStack.size(); ++i) {
+            path.addKey(static_cast<float>(i + 1), rotationStack.prefixProduct(i + 1));
+        }
+        path.prepare();
+    }
+
+    // ghost tersebar rata di sepanjang jalur stack (tanpa kedua ujungnya, itu sudah digambar abu-abu & putih),
+    // makin dekat ke pose akhir makin terang. Wireframe mesh dibangun sekali per mesh, per ghost cuma transform
+    void Application::drawGhosts(const Matrix4f& viewMatrix, const Matrix4f& projectionMatrix) {
+        size_t count = uiManager->getGhostCount();
+        if (count == 0 || rotationStack.empty()) return;
+
+        buildStackPath(ghostPath);
+        std::vector<float> times(count);
+        for (size_t i = 0; i < count; ++i) {
+            times[i] = ghostPath.getEndTime() * static_cast<float>(i + 1) / static_cast<float>(count + 1);
+        }
+        std::vector<Quaternionf> poses(count);
+        ghostPath.sampleBatch(times.data(), count, poses.data());
+
+        std::vector<Matrix4f> modelMatrices(count);
+        std::vector<SDL_Color> colors(count);
+        for (size_t i = 0; i < count; ++i) {
+            modelMatrices[i] = Matrix4f::fromQuaternion(poses[i]);
+            float t = static_cast<float>(i + 1) / static_cast<float>(count + 1);
+            colors[i] = {static_cast<Uint8>(70.0f + 130.0f * t), static_cast<Uint8>(55.0f + 95.0f * t),
+                         static_cast<Uint8>(40.0f + 40.0f * t), 255};
+        }
+        mainRenderer->drawWireframes(*mesh, currentWireframe(), modelMatrices.data(), colors.data(), count, viewMatrix, projectionMatrix);
+    }
+
+    // titik berseberangan di kulit bola = rotasi yang sama, jadi lompatan sejauh itu bukan segmen: polyline diputus
+    void Application::drawS3Polyline(const std::vector<Vector3f>& points, const Matrix4f& mvpMatrix, Uint8 r, Uint8 g, Uint8 b) {
+        size_t runStart = 0;
+        for (size_t i = 1; i <= points.size(); ++i) {
+            bool jump = i < points.size() && (points[i] - points[i - 1]).length() > S3_CLOUD_RADIUS;
+            if (i == points.size() || jump) {
+                mainRenderer->drawPolyline(points.data() + runStart, i - runStart, mvpMatrix, r, g, b, 255);
+                runStart = i;
+            }
+        }
+    }
+
+    void Application::drawSweepTrajectory(const std::vector<Vector3f>& points, const Matrix4f& mvpMatrix,
+                                          Uint8 r, Uint8 g, Uint8 b) {
+        mainRenderer->drawPolyline(points.data(), points.size(), mvpMatrix, r, g, b, 255);
+
+        // bagian yang dekat gimbal lock ditimpa kuning, per potongan yang bersambung
+        size_t runStart = 0;
+        bool inRun = false;
+        for (size_t i = 0; i <= points.size(); ++i) {
+            bool locked = i < points.size() && gimbalSweep.conditionNumbers[i] > GIMBAL_LOCK_CONDITION;
+            if (locked && !inRun) {
+                runStart = i;
+                inRun = true;
+            } else if (!locked && inRun) {
+                mainRenderer->drawPolyline(points.data() + runStart, i - runStart, mvpMatrix, 255, 230, 0, 255);
+                inRun = false;
+            }
+        }
+    }
+
+    void Application::drawGimbalSweep(const Matrix4f& viewProjectionMatrix) {
+        if (!gimbalSweepValid || gimbalSweep.size() == 0) return;
+
+        Matrix4f mvpMatrix = viewProjectionMatrix * Matrix4f::scale(Vector3f(GIMBAL_TRAJECTORY_RADIUS,
+                                                                             GIMBAL_TRAJECTORY_RADIUS,
+                                                                             GIMBAL_TRAJECTORY_RADIUS));
+        // lintasan ujung sumbu X/Y/Z model selama satu sudut di-sweep
+        drawSweepTrajectory(gimbalSweep.axisX, mvpMatrix, 255, 80, 80);
+        drawSweepTrajectory(gimbalSweep.axisY, mvpMatrix, 80, 255, 80);
+        drawSweepTrajectory(gimbalSweep.axisZ, mvpMatrix, 80, 80, 255);
+
+        float first, second, third;
+        uiManager->getGimbalExplorerAngles(first, second, third);
+        Matrix4f pose = math::RotationConversion<float>::anglesToMatrix(Vector3f(first, second, third), gimbalSweep.order);
+        const Vector3f origin(0.0f, 0.0f, 0.0f);
+        mainRenderer->drawArrow(origin, Vector3f(pose(0, 0), pose(1, 0), pose(2, 0)) * GIMBAL_TRAJECTORY_RADIUS,
+                                viewProjectionMatrix, 255, 80, 80, 255);
+        mainRenderer->drawArrow(origin, Vector3f(pose(0, 1), pose(1, 1), pose(2, 1)) * GIMBAL_TRAJECTORY_RADIUS,
+                                viewProjectionMatrix, 80, 255, 80, 255);
+        mainRenderer->drawArrow(origin, Vector3f(pose(0, 2), pose(1, 2), pose(2, 2)) * GIMBAL_TRAJECTORY_RADIUS,
+                                viewProjectionMatrix, 80, 80, 255, 255);
     }
 
     void Application::render() {
         mainRenderer->clearScreen(0x1A, 0x1A, 0x1A, 0xFF);
+        if (uiManager->isCompareViewEnabled()) {
+            renderComparison();
+            uiManager->render();
+            mainRenderer->present();
+            return;
+        }
 
         Matrix4f viewMatrix = mainCamera->getViewMatrix();
         Matrix4f projectionMatrix = mainCamera->getProjectionMatrix(mainWindow->getWidth(), mainWindow->getHeight());
@@ -253,56 +802,188 @@ namespace app {
 
         mainRenderer->drawAxesWithLabels(viewProjectionMatrix);
 
-        if (!mesh.vertices.empty()) {
+        if (uiManager->isGimbalExplorerEnabled()) {
+            drawGimbalSweep(viewProjectionMatrix);
+        }
+        if (uiManager->getS3ViewMode() != ui::S3ViewMode::OFF && s3CloudValid) {
+            drawS3Cloud(viewProjectionMatrix);
+        }
+
+        if (mesh && !mesh->empty()) {
             if (hasRotation) {
-                mainRenderer->drawMesh(mesh, originalModelMatrix, viewMatrix, projectionMatrix, 100, 100, 100, 255);
-                mainRenderer->drawMesh(mesh, rotatedModelMatrix, viewMatrix, projectionMatrix, 255, 255, 255, 255);
+                drawGhosts(viewMatrix, projectionMatrix);
+                mainRenderer->drawMesh(*mesh, originalModelMatrix, viewMatrix, projectionMatrix, 100, 100, 100, 255);
+                // pose antara (sampai langkah yang dipilih), kalau yang dipilih bukan langkah terakhir
+                size_t selected = uiManager->getSelectedStackStep();
+                if (selected + 1 < rotationStack.size()) {
+                    Matrix4f intermediate = Matrix4f::fromQuaternion(rotationStack.prefixProduct(selected + 1));
+                    mainRenderer->drawMesh(*mesh, intermediate, viewMatrix, projectionMatrix, 90, 150, 220, 255);
+                }
+                mainRenderer->drawMesh(*mesh, rotatedModelMatrix, viewMatrix, projectionMatrix, 255, 255, 255, 255);
                 drawRotationAxis(viewProjectionMatrix);
                 drawAngleLabel(viewProjectionMatrix);
             } else {
-                mainRenderer->drawMesh(mesh, originalModelMatrix, viewMatrix, projectionMatrix, 100, 100, 100, 255);
+                mainRenderer->drawMesh(*mesh, originalModelMatrix, viewMatrix, projectionMatrix, 100, 100, 100, 255);
             }
         }
         uiManager->render();
         mainRenderer->present();
     }
 
+graphics::Mesh<float> Application::loadMesh(const std::string& filename) {
+    graphics::Mesh<float> mesh = graphics::MeshLoader<float>::loadFromFile(filename);
+    if (weldVerticesOnLoad) {
+        graphics::WeldResult weld = graphics::MeshWelder<float>::weld(mesh, weldTolerance);
+        std::cout << "Welding vertex: " << weld.originalVertexCount << " -> " << weld.weldedVertexCount
+                  << " (" << weld.removedVertexCount() << " duplikat dihapus, "
+                  << weld.removedFaceCount << " face degenerate dibuang)" << std::endl;
+    }
+    if (mesh.vertices.size() > quantizeAboveVertexCount) {
+        size_t fullBytes = mesh.vertices.size() * sizeof(Vector3f);
+        graphics::MeshQuantizer<float>::quantize(mesh);
+        size_t quantizedBytes = mesh.quantizedVertices.size() * sizeof(mesh.quantizedVertices[0]);
+        std::cout << "Vertex dikuantisasi 16-bit: " << fullBytes / 1024 << " KB -> "
+                  << quantizedBytes / 1024 << " KB" << std::endl;
+    }
+    return mesh;
+}
+
 void Application::onFileSelected(const std::string& filename) {
     std::cout << "Memuat file: " << filename << std::endl;
     
     try {
-        mesh = graphics::ObjLoader<float>::loadObj(filename);
-        std::cout << "Berhasil memaut file: " << filename << std::endl;
-        std::cout << "Vertices: " << mesh.vertices.size() << std::endl;
-        std::cout << "Faces: " << mesh.faces.size() << std::endl;
+        bool cached = meshCache->contains(filename);
+        mesh = meshCache->get(filename);
+        std::cout << "Berhasil memaut file: " << filename << (cached ? " (dari cache)" : "") << std::endl;
+        std::cout << "Vertices: " << mesh->vertexCount() << std::endl;
+        std::cout << "Faces: " << mesh->faces.size() << std::endl;
+        std::cout << "Cache mesh: " << meshCache->getEntryCount() << " file, "
+                  << meshCache->getUsedBytes() / (1024 * 1024) << " / "
+                  << meshCache->getCapacityBytes() / (1024 * 1024) << " MB" << std::endl;
         
+        stopSpin(false);
+        stopAnimation();
         hasRotation = false;
         originalModelMatrix = Matrix4f::identity();
         rotatedModelMatrix = Matrix4f::identity();
+        rotationStack.clear();
+        refreshRotationStack(0);
         
     } catch (const std::exception& e) {
         std::cerr << "Gagal memuat " << filename << ": " << e.what() << std::endl;
     }
 }
 
-    void Application::onApplyRotation() {
+    // rotasi best-fit dari mesh yang sedang dimuat ke target (vertex berpasangan per index), diisi ke field quaternion
+    // sebagai langkah yang membawa pose sekarang ke sana; baru berubah kalau user menekan Apply. Translasinya cuma
+    // dilaporkan (model selalu digambar di origin)
+    void Application::onFitTargetSelected(const std::string& filename) {
+        if (!mesh) {
+            uiManager->setStatus("Muat model dulu sebelum fit");
+            return;
+        }
+
+        graphics::MeshCache<float>::MeshHandle target;
+        try {
+            target = meshCache->get(filename);
+        } catch (const std::exception& e) {
+            std::cerr << "Gagal memuat target " << filename << ": " << e.what() << std::endl;
+            uiManager->setStatus("Gagal memuat target");
+            return;
+        }
+        size_t count = mesh->vertexCount();
+        if (target->vertexCount() != count || count == 0) {
+            std::cerr << "Jumlah vertex target (" << target->vertexCount() << ") beda dengan model (" << count << ")" << std::endl;
+            uiManager->setStatus("Vertex target tidak berpasangan dengan model");
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        using Aligner = math::HornAligner<float>;
+        const math::AlignmentSums origin(mesh->getVertex(0), target->getVertex(0));
+        math::AlignmentSums sums = origin;
+        std::mutex sumsMutex;
+        workerPool->parallelFor(count, FIT_CHUNK_POINTS, [&](size_t begin, size_t end) {
+            // getVertex juga menangani mesh terkuantisasi; disalin ke SoA per blok buat kernel SIMD
+            float source[3][Aligner::BLOCK_SIZE], destination[3][Aligner::BLOCK_SIZE];
+            math::AlignmentSums local = origin;
+            for (size_t blockBegin = begin; blockBegin < end; blockBegin += Aligner::BLOCK_SIZE) {
+                size_t blockCount = std::min(Aligner::BLOCK_SIZE, end - blockBegin);
+                for (size_t i = 0; i < blockCount; ++i) {
+                    Vector3f a = mesh->getVertex(blockBegin + i);
+                    Vector3f b = target->getVertex(blockBegin + i);
+                    source[0][i] = a.x; source[1][i] = a.y; source[2][i] = a.z;
+                    destination[0][i] = b.x; destination[1][i] = b.y; destination[2][i] = b.z;
+                }
+                Aligner::accumulate({source[0], source[1], source[2]}, {destination[0], destination[1], destination[2]},
+                                    blockCount, local);
+            }
+            std::lock_guard<std::mutex> lock(sumsMutex);
+            sums.merge(local);
+        });
+        math::AlignmentResult<float> fit = Aligner::solve(sums);
+        double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        // pose sekarang * langkah = hasil fit
+        Quaternionf step = (rotationStack.product().conjugate() * fit.rotation).normalize();
+        if (step.w < 0.0f) step = Quaternionf(-step.w, -step.x, -step.y, -step.z);
+        float sinHalf = std::sqrt(step.x * step.x + step.y * step.y + step.z * step.z);
+        float angle = 2.0f * std::atan2(sinHalf, step.w) * (180.0f / 3.141592653589793f);
+        Vector3f axis = sinHalf > 1e-7f ? Vector3f(step.x / sinHalf, step.y / sinHalf, step.z / sinHalf) : Vector3f(1.0f, 0.0f, 0.0f);
+
+        uiManager->setRotationMethod(ui::RotationMethod::QUATERNION);
+        uiManager->setRotationAxis(axis.x, axis.y, axis.z);
+        uiManager->setRotationAngle(angle);
+
+        std::ostringstream status;
+        status << std::setprecision(3) << "Fit " << count << " titik: RMS " << fit.rmsError << ", " << std::fixed
+               << std::setprecision(1) << elapsedMs << " ms" << (fit.unique ? "" : " (rotasi tidak tunggal)");
+        uiManager->setStatus(status.str());
+        std::cout << status.str() << std::endl;
+        std::cout << "Rotasi best-fit: q = (" << fit.rotation.w << ", " << fit.rotation.x << ", " << fit.rotation.y << ", "
+                  << fit.rotation.z << "), translasi (" << fit.translation.x << ", " << fit.translation.y << ", "
+                  << fit.translation.z << ") [kernel " << Aligner::kernels().name << "]" << std::endl;
+    }
+
+    // sumbu quaternion dari UI, sudah dinormalisasi; false (plus status) kalau sumbunya nol
+    bool Application::readRotationAxis(Vector3f& axis) {
+        float x, y, z;
+        uiManager->getRotationAxis(x, y, z);
+        axis = Vector3f(x, y, z);
+        if (!(axis.length() > 0.0f)) {
+            uiManager->setStatus("Sumbu putar nol, rotasi diabaikan");
+            return false;
+        }
+        axis = axis.normalize();
+        return true;
+    }
+
+    // langkah rotasi dari parameter UI sekarang. Keyframe animasinya ditambahkan ke rotationTrack mulai dari current
+    // (Euler/Tait-Bryan per sumbu), current ikut maju sampai pose sesudah langkah ini
+    // false (tanpa keyframe) kalau input metode yang aktif nggak membentuk rotasi, mis. sumbu quaternion nol
+    bool Application::composeStepFromUI(float& time, Quaternionf& current, Quaternionf& step) {
         ui::RotationMethod method = uiManager->getRotationMethod();
-        
+        const Vector3f axisX(1.0f, 0.0f, 0.0f);
+        const Vector3f axisY(0.0f, 1.0f, 0.0f);
+        const Vector3f axisZ(0.0f, 0.0f, 1.0f);
+
+        // sumbu dinormalisasi sekali; keyframe dan langkah di stack pakai sumbu yang sama persis
+        Vector3f rotationAxis;
+        if (method == ui::RotationMethod::QUATERNION && !readRotationAxis(rotationAxis)) {
+            return false;
+        }
+
         switch (method) {
             case ui::RotationMethod::QUATERNION: {
                 float angle = uiManager->getRotationAngle();
-                float x, y, z;
-                uiManager->getRotationAxis(x, y, z);
                 
                 std::cout << "Menerapkan rotasi dengan Quaternion: " << angle << "° di sumbu putar (" 
-                        << x << ", " << y << ", " << z << ")" << std::endl;
+                        << rotationAxis.x << ", " << rotationAxis.y << ", " << rotationAxis.z << ")" << std::endl;
                 
-                Vector3f rotationAxis(x, y, z);
                 float rotationAngleRad = angle * (3.141592653589793f / 180.0f);
-                Quaternionf rotation = Quaternionf::fromAxisAngle(rotationAxis, rotationAngleRad);
-                
-                rotatedModelMatrix = Matrix4f::fromQuaternion(rotation);
-                break;
+                appendRotationKeys(rotationAxis, angle, time, current);
+                step = Quaternionf::fromAxisAngle(rotationAxis, rotationAngleRad);
+                return true;
             }
             
             case ui::RotationMethod::EULER_ANGLES: {
@@ -312,32 +993,196 @@ void Application::onFileSelected(const std::string& filename) {
                 std::cout << "Menerapkan rotasi dengan Euler angles: α=" << alpha << "°, β=" << beta 
                         << "°, γ=" << gamma << "°" << std::endl;
                 
-                rotatedModelMatrix = math::EulerAngles<float>::fromZYX(alpha, beta, gamma);
-                break;
+                // Rz(α) * Ry(β) * Rx(γ): tiap sumbu dianimasikan bergantian
+                appendRotationKeys(axisZ, alpha, time, current);
+                appendRotationKeys(axisY, beta, time, current);
+                appendRotationKeys(axisX, gamma, time, current);
+                step = math::EulerAngles<float>::toQuaternion(alpha, beta, gamma);
+                return true;
             }
             
-            case ui::RotationMethod::TAIT_BRYAN: {
+            case ui::RotationMethod::TAIT_BRYAN:
+            default: {
                 float yaw, pitch, roll;
                 uiManager->getTaitBryanAngles(yaw, pitch, roll);
                 
                 std::cout << "Menerapkan rotasi dengan Tait-Bryan: yaw=" << yaw << "°, pitch=" 
                         << pitch << "°, roll=" << roll << "°" << std::endl;
                 
-                rotatedModelMatrix = math::TaitBryanAngles<float>::fromYawPitchRoll(yaw, pitch, roll);
-                break;
+                appendRotationKeys(axisZ, yaw, time, current);
+                appendRotationKeys(axisY, pitch, time, current);
+                appendRotationKeys(axisX, roll, time, current);
+                step = math::TaitBryanAngles<float>::toQuaternion(yaw, pitch, roll);
+                return true;
             }
         }
-        
+    }
+
+    // langkah saja, tanpa keyframe/log (Insert & Replace animasinya lewat animateBetween); false kalau sumbu nol
+    bool Application::stepFromUI(Quaternionf& step) {
+        ui::RotationMethod method = uiManager->getRotationMethod();
+        Vector3f rotationAxis;
+        if (method == ui::RotationMethod::QUATERNION && !readRotationAxis(rotationAxis)) {
+            return false;
+        }
+        step = previewStep(method);
+        return true;
+    }
+
+    // Apply menambah langkah di akhir stack; animasinya mulai dari pose akhir sebelumnya
+    void Application::onApplyRotation() {
+        stopSpin(true);
+        rotationTrack.clear();
+        rotationTrack.setInterpolation(math::RotationInterpolation::SLERP);
+        Quaternionf current = rotationStack.product();
+        float time = 0.0f;
+        rotationTrack.addKey(time, current);
+
+        Quaternionf step;
+        if (!composeStepFromUI(time, current, step)) return;
+        rotationStack.pushBack(step);
+        startAnimation();
+        refreshRotationStack(rotationStack.size() - 1);
+        std::cout << "Rotasi berhasil! (" << rotationStack.size() << " langkah)" << std::endl;
+    }
+
+    void Application::onInsertStackStep() {
+        stopSpin(true);
+        size_t index = rotationStack.empty() ? 0 : std::min(uiManager->getSelectedStackStep(), rotationStack.size());
+        Quaternionf previous = rotationStack.product();
+        Quaternionf step;
+        if (!stepFromUI(step)) return;
+        rotationStack.insert(index, step);
+        animateBetween(previous, rotationStack.product());
+        refreshRotationStack(index);
+    }
+
+    void Application::onReplaceStackStep() {
+        stopSpin(true);
+        if (rotationStack.empty()) return;
+        size_t index = std::min(uiManager->getSelectedStackStep(), rotationStack.size() - 1);
+        Quaternionf previous = rotationStack.product();
+        Quaternionf step;
+        if (!stepFromUI(step)) return;
+        rotationStack.set(index, step);
+        animateBetween(previous, rotationStack.product());
+        refreshRotationStack(index);
+    }
+
+    void Application::onRemoveStackStep() {
+        stopSpin(true);
+        if (rotationStack.empty()) return;
+        size_t index = std::min(uiManager->getSelectedStackStep(), rotationStack.size() - 1);
+        Quaternionf previous = rotationStack.product();
+        rotationStack.erase(index);
+        animateBetween(previous, rotationStack.product());
+        refreshRotationStack(index > 0 ? index - 1 : 0);
+    }
+
+    // edit di tengah stack: pose akhir lama -> baru lewat satu slerp (pecahan per sumbu cuma masuk akal buat langkah terakhir)
+    void Application::animateBetween(const Quaternionf& from, const Quaternionf& to) {
+        rotationTrack.clear();
+        rotationTrack.setInterpolation(math::RotationInterpolation::SLERP);
+        rotationTrack.addKey(0.0f, from);
+        rotationTrack.addKey(ROTATION_STEP_SECONDS, to);
+        startAnimation();
+    }
+
+    void Application::startAnimation() {
+        rotationTrack.prepare();
+        targetModelMatrix = Matrix4f::fromQuaternion(rotationStack.product());
+        rotatedModelMatrix = Matrix4f::fromQuaternion(rotationTrack.sample(0.0f));
+        animationTime = 0.0f;
+        animating = true;
+        hasRotation = !rotationStack.empty();
+    }
+
+    void Application::refreshRotationStack(size_t selected) {
+        size_t count = rotationStack.size();
+        if (count == 0) {
+            uiManager->setRotationStackState(0, 0, "Stack kosong", "");
+            return;
+        }
+        selected = std::min(selected, count - 1);
+
+        auto format = [](const Quaternionf& q) {
+            std::ostringstream oss;
+            oss << std::fixed << std::setprecision(3) << "(" << q.w << ", " << q.x << ", " << q.y << ", " << q.z << ")";
+            return oss.str();
+        };
+        uiManager->setRotationStackState(selected, count,
+                                         "Langkah: q = " + format(rotationStack.get(selected)),
+                                         "Pose s/d langkah: " + format(rotationStack.prefixProduct(selected + 1)));
+    }
+
+    // rotasi lokal (dikalikan di kanan) sebesar angleDegrees, dipecah jadi keyframe maksimal MAX_KEY_ANGLE_DEGREES.
+    // Sudut nol nggak nambah keyframe, jadi sumbu yang nggak diputar nggak makan waktu animasi
+    void Application::appendRotationKeys(const Vector3f& axis, float angleDegrees, float& time, Quaternionf& current) {
+        if (angleDegrees == 0.0f || axis.length() == 0.0f) return;
+
+        int steps = static_cast<int>(std::ceil(std::abs(angleDegrees) / MAX_KEY_ANGLE_DEGREES));
+        float stepRadians = angleDegrees / static_cast<float>(steps) * (3.141592653589793f / 180.0f);
+        Quaternionf step = Quaternionf::fromAxisAngle(axis.normalize(), stepRadians);
+        for (int i = 0; i < steps; ++i) {
+            current = current * step;
+            time += ROTATION_STEP_SECONDS / static_cast<float>(steps);
+            rotationTrack.addKey(time, current);
+        }
+    }
+
+    // pose sekarang jadi titik awal integrasi; animasi yang sedang jalan dihentikan di pose akhirnya
+    void Application::startSpin() {
+        stopAnimation();
+        spinIntegrator.reset(rotationStack.product());
+        spinning = true;
         hasRotation = true;
-        std::cout << "Rotasi berhasil!" << std::endl;
+        uiManager->setStatus("Spin: sumbu & sudut (°/detik) dibaca tiap frame");
+    }
+
+    void Application::updateSpin(float deltaTime) {
+        float x, y, z;
+        uiManager->getRotationAxis(x, y, z);
+        float length = std::sqrt(x * x + y * y + z * z);
+        float speed = length > 0.0f ? uiManager->getRotationAngle() * (3.141592653589793f / 180.0f) / length : 0.0f;
+        spinIntegrator.setAngularVelocity(Vector3f(x * speed, y * speed, z * speed));
+        spinIntegrator.advance(deltaTime);
+        rotatedModelMatrix = Matrix4f::fromQuaternion(spinIntegrator.sampleOrientation());
+    }
+
+    // keepPose: putaran selama spin disimpan sebagai satu langkah di akhir stack; kalau nggak, pose balik ke stack
+    void Application::stopSpin(bool keepPose) {
+        if (!spinning) return;
+        spinning = false;
+        uiManager->setSpinEnabled(false);
+        if (keepPose) {
+            Quaternionf step = (rotationStack.product().conjugate() * spinIntegrator.sampleOrientation()).normalize();
+            rotationStack.pushBack(step);
+            refreshRotationStack(rotationStack.size() - 1);
+            std::ostringstream status;
+            status << std::fixed << std::setprecision(1) << "Spin berhenti: " << spinIntegrator.getSimulatedTime()
+                   << " detik, " << spinIntegrator.getStepCount() << " langkah";
+            uiManager->setStatus(status.str());
+        }
+        targetModelMatrix = Matrix4f::fromQuaternion(rotationStack.product());
+        rotatedModelMatrix = targetModelMatrix;
+        hasRotation = !rotationStack.empty();
+    }
+
+    void Application::stopAnimation() {
+        animating = false;
+        animationTime = 0.0f;
     }
 
 
     void Application::onResetRotation() {
         std::cout << "Mereset rotasi" << std::endl;
         
+        stopSpin(false);
+        stopAnimation();
         hasRotation = false;
         rotatedModelMatrix = Matrix4f::identity();
+        rotationStack.clear();
+        refreshRotationStack(0);
         
         uiManager->setRotationAxis(1.0f, 0.0f, 0.0f);
         uiManager->setRotationAngle(45.0f);
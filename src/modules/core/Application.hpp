@@ -1,11 +1,20 @@
 #pragma once
 #include "Window.hpp"
+#include "ThreadPool.hpp"
 #include "../graphics/Renderer.hpp"
 #include "../graphics/Camera.hpp"
 #include "../graphics/Mesh.hpp"
+#include "../graphics/MeshCache.hpp"
 #include "../math/Quaternion.hpp"
 #include "../math/Vector3.hpp"    
 #include "../math/Matrix4.hpp" 
+#include "../math/RotationTrack.hpp"
+#include "../math/RotationStack.hpp"
+#include "../math/GimbalSweep.hpp"
+#include "../math/PointAlignment.hpp"
+#include "../math/OrientationIndex.hpp"
+#include "../math/S3Projection.hpp"
+#include "../math/AngularVelocity.hpp"
 #include "../ui/UIManager.hpp"
 #include <memory>                        
 #include <sstream>                       
@@ -22,7 +31,8 @@ namespace app {
         Window* mainWindow;
         graphics::Renderer<float>* mainRenderer;
         graphics::Camera<float>* mainCamera;
-        graphics::Mesh<float> mesh;
+        graphics::MeshCache<float>::MeshHandle mesh;
+        std::unique_ptr<graphics::MeshCache<float>> meshCache;
 
         std::unique_ptr<ui::UIManager> uiManager;
 
@@ -40,12 +50,138 @@ namespace app {
         math::Matrix4<float> originalModelMatrix;
         math::Matrix4<float> rotatedModelMatrix;
         bool hasRotation = false;
+
+        // semua rotasi yang sudah diterapkan, berurutan; pose yang ditampilkan = hasil kali seluruh stack
+        math::RotationStack<float> rotationStack;
+
+        // rotasi yang diterapkan dianimasikan sepanjang track keyframe (bukan langsung loncat ke hasil akhir);
+        // Euler/Tait-Bryan dipecah per sumbu supaya urutan rotasinya kelihatan
+        math::RotationTrack<float> rotationTrack;
+        math::Matrix4<float> targetModelMatrix;
+        float animationTime = 0.0f;
+        bool animating = false;
+        static constexpr float ROTATION_STEP_SECONDS = 0.6f;
+        // keyframe paling jauh 90° supaya slerp nggak ambil jalur pendek buat sudut > 180°
+        static constexpr float MAX_KEY_ANGLE_DEGREES = 90.0f;
+
+        // mode spin: orientasi diintegrasi dengan timestep tetap (lepas dari frame rate), ditampilkan di waktu frame
+        static constexpr float SPIN_STEP_SECONDS = 1.0f / 240.0f;
+        math::AngularVelocityIntegrator<float> spinIntegrator{SPIN_STEP_SECONDS};
+        bool spinning = false;
+
+        // welding vertex duplikat waktu load (export CAD sering duplikat posisi per face)
+        bool weldVerticesOnLoad = true;
+        float weldTolerance = 1e-5f;
+
+        // mesh di atas batas ini disimpan terkuantisasi 16-bit (hemat memori 2x buat float)
+        size_t quantizeAboveVertexCount = 1000000;
+
+        // model yang baru dipakai disimpan di cache LRU, jadi bolak-balik model nggak perlu parse ulang
+        static constexpr size_t MESH_CACHE_CAPACITY_BYTES = 512u * 1024u * 1024u;
+
+        // kerjaan berat yang bisa dipotong-potong (sweep gimbal, jumlahan best-fit) dibagi ke sini
+        std::unique_ptr<ThreadPool> workerPool;
+
+        // gimbal-lock explorer: sweep dihitung ulang cuma kalau konvensi/sudut berubah (mis. waktu slider di-drag)
+        math::GimbalSweep<float> gimbalSweep;
+        bool gimbalSweepValid = false;
+        static constexpr size_t GIMBAL_SWEEP_SAMPLES = 2048;
+        static constexpr float GIMBAL_TRAJECTORY_RADIUS = 2.2f;
+        // di atas kondisi ini lintasannya ditandai "dekat gimbal lock"
+        static constexpr float GIMBAL_LOCK_CONDITION = 10.0f;
+
+        // best-fit ke scan: titik per potongan thread (kelipatan HornAligner::BLOCK_SIZE)
+        static constexpr size_t FIT_CHUNK_POINTS = 64 * 1024;
+
+        // library orientasi referensi (pose kamera, fixture), satu per baris: "w x y z [nama]". Orientasi yang
+        // sedang diedit dicari tetangga terdekatnya tiap kali berubah
+        static constexpr const char* ORIENTATION_LIBRARY_PATH = "models/orientations.txt";
+        static constexpr float NEAR_ORIENTATION_DEGREES = 10.0f;
+        math::OrientationIndex<float> orientationIndex;
+        std::vector<std::string> orientationNames;
+        math::Quaternion<float> lastOrientationQuery;
+        bool orientationQueryValid = false;
+
+        // tampilan S^3: sampel quaternion -> titik stereografik (mode Hopf: diwarnai per titik dasar & fiber-nya
+        // digambar). Sampel dan posisi 3D cuma dihitung ulang kalau parameternya berubah; proyeksi ke layar tiap
+        // frame, paralel per potongan, lalu tiap potongan dikirim ke SDL sebagai satu batch
+        struct S3Chunk {
+            size_t begin, end;
+            uint8_t bucket; // warna (mode Hopf); titik sudah diurutkan per bucket jadi satu potongan satu warna
+        };
+        struct S3CloudKey {
+            ui::S3ViewMode mode = ui::S3ViewMode::OFF;
+            ui::S3SampleSet sampleSet = ui::S3SampleSet::NEAR_POSE;
+            size_t count = 0;
+            float radius = 0.0f;
+            std::vector<math::Quaternion<float>> stack; // pusat "sekitar pose" & titik-titik trajektori
+
+            bool operator==(const S3CloudKey& other) const;
+        };
+        S3CloudKey s3CloudKey;
+        bool s3CloudValid = false;
+        math::QuaternionArray<float> s3Samples;
+        std::vector<math::Vector3<float>> s3Positions;
+        std::vector<S3Chunk> s3Chunks;
+        std::vector<SDL_Point> s3ScreenPoints;
+        std::vector<size_t> s3VisibleCounts;
+        std::vector<std::vector<math::Vector3<float>>> s3Fibers; // fiber terakhir = fiber pose sekarang
+        static constexpr float S3_CLOUD_RADIUS = 2.0f;
+        static constexpr size_t S3_HOPF_BUCKETS = 12;
+        static constexpr size_t S3_FIBER_SEGMENTS = 256;
         
+        // wireframe mesh yang sedang dipakai (ghost & tampilan banding), dibangun ulang cuma kalau mesh-nya ganti
+        graphics::Wireframe<float> meshWireframe;
+        graphics::MeshCache<float>::MeshHandle meshWireframeSource;
+        // onion skin: pose antara di sepanjang jalur stack
+        math::RotationTrack<float> ghostPath;
+
+        // tampilan banding: viewport ke-i = metode ke-i (urutan ui::RotationMethod), kamera masing-masing (disalin
+        // dari kamera utama waktu diaktifkan, dibuang waktu dimatikan). Keyboard/mouse menggerakkan kamera viewport
+        // di bawah kursor
+        static constexpr int COMPARE_VIEWPORT_COUNT = 3;
+        std::vector<graphics::Camera<float>> compareCameras;
+        
+        graphics::Mesh<float> loadMesh(const std::string& filename);
         void onFileSelected(const std::string& filename);
+        void onFitTargetSelected(const std::string& filename);
+        void loadOrientationLibrary(const std::string& filename);
+        void updateNearestOrientation();
+        void updateS3Cloud();
+        void buildStackPath(math::RotationTrack<float>& path) const;
+        const graphics::Wireframe<float>& currentWireframe();
+        void onCompareViewToggled(bool enabled);
+        graphics::Camera<float>* activeCamera();
+        const graphics::Camera<float>* activeCamera() const;
+        math::Quaternion<float> previewStep(ui::RotationMethod method) const;
+        void renderComparison();
+        void drawGhosts(const math::Matrix4<float>& viewMatrix, const math::Matrix4<float>& projectionMatrix);
+        void drawS3Cloud(const math::Matrix4<float>& viewProjectionMatrix);
+        void drawS3Polyline(const std::vector<math::Vector3<float>>& points, const math::Matrix4<float>& mvpMatrix,
+                            Uint8 r, Uint8 g, Uint8 b);
         void onApplyRotation();
         void onResetRotation();
+        void onInsertStackStep();
+        void onReplaceStackStep();
+        void onRemoveStackStep();
+        bool readRotationAxis(math::Vector3<float>& axis);
+        bool composeStepFromUI(float& time, math::Quaternion<float>& current, math::Quaternion<float>& step);
+        bool stepFromUI(math::Quaternion<float>& step);
+        void animateBetween(const math::Quaternion<float>& from, const math::Quaternion<float>& to);
+        void startAnimation();
+        void refreshRotationStack(size_t selected);
+        void appendRotationKeys(const math::Vector3<float>& axis, float angleDegrees, float& time, math::Quaternion<float>& current);
+        void stopAnimation();
+        void startSpin();
+        void updateSpin(float deltaTime);
+        void stopSpin(bool keepPose);
 
         void drawRotationAxis(const math::Matrix4<float>& viewProjectionMatrix);
         void drawAngleLabel(const math::Matrix4<float>& viewProjectionMatrix);
+
+        void updateGimbalSweep();
+        void drawGimbalSweep(const math::Matrix4<float>& viewProjectionMatrix);
+        void drawSweepTrajectory(const std::vector<math::Vector3<float>>& points, const math::Matrix4<float>& mvpMatrix,
+                                 Uint8 r, Uint8 g, Uint8 b);
     };
 } // namespace app
@@ -0,0 +1,121 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace app {
+    // pool worker sederhana; job dijalankan FIFO, destructor nunggu job yang sedang jalan lalu buang sisanya
+    class ThreadPool {
+    public:
+        using Job = std::function<void()>;
+
+        explicit ThreadPool(size_t workerCount = defaultWorkerCount()) {
+            workerCount = std::max<size_t>(1, workerCount);
+            for (size_t i = 0; i < workerCount; ++i) {
+                workers.emplace_back([this]() { workerLoop(); });
+            }
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+                jobs.clear();
+            }
+            wake.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void submit(Job job) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                jobs.push_back(std::move(job));
+            }
+            wake.notify_one();
+        }
+
+        size_t getWorkerCount() const { return workers.size(); }
+
+        // body(begin, end) dipanggil buat tiap potongan [0, count) selebar grain, paralel di worker + thread pemanggil;
+        // return setelah semua potongan selesai. Thread pemanggil ikut ngerjain, jadi tetap selesai walau semua
+        // worker lagi sibuk dengan job lain (potongannya cuma dikerjain pemanggil sendiri)
+        void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) {
+            if (count == 0) return;
+            grain = std::max<size_t>(1, grain);
+            size_t chunkCount = (count + grain - 1) / grain;
+            if (chunkCount == 1) {
+                body(0, count);
+                return;
+            }
+
+            // state di heap: worker yang baru sempat jalan sesudah semua potongan selesai masih boleh nyentuh state-nya
+            // (body nggak disentuh lagi, karena nggak ada potongan tersisa)
+            struct Range {
+                std::atomic<size_t> next{0};
+                std::atomic<size_t> done{0};
+                std::mutex mutex;
+                std::condition_variable finished;
+            };
+            auto range = std::make_shared<Range>();
+            const std::function<void(size_t, size_t)>* bodyPointer = &body;
+            auto work = [range, bodyPointer, count, grain, chunkCount]() {
+                size_t chunk;
+                while ((chunk = range->next.fetch_add(1)) < chunkCount) {
+                    size_t begin = chunk * grain;
+                    (*bodyPointer)(begin, std::min(count, begin + grain));
+                    if (range->done.fetch_add(1) + 1 == chunkCount) {
+                        std::lock_guard<std::mutex> lock(range->mutex);
+                        range->finished.notify_all();
+                    }
+                }
+            };
+
+            size_t helpers = std::min(workers.size(), chunkCount - 1);
+            for (size_t i = 0; i < helpers; ++i) {
+                submit(work);
+            }
+            work();
+
+            std::unique_lock<std::mutex> lock(range->mutex);
+            range->finished.wait(lock, [&range, chunkCount]() { return range->done.load() == chunkCount; });
+        }
+
+        // sisain satu core buat thread UI
+        static size_t defaultWorkerCount() {
+            unsigned int cores = std::thread::hardware_concurrency();
+            return cores > 1 ? cores - 1 : 1;
+        }
+
+    private:
+        std::vector<std::thread> workers;
+        std::deque<Job> jobs;
+        std::mutex mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+
+        void workerLoop() {
+            while (true) {
+                Job job;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [this]() { return stopping || !jobs.empty(); });
+                    if (stopping) return;
+                    job = std::move(jobs.front());
+                    jobs.pop_front();
+                }
+                job();
+            }
+        }
+    };
+} // namespace app
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace graphics {
+    // file read-only yang di-mmap (POSIX); di Windows fallback baca semua ke buffer
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::string& filePath) {
+#ifdef _WIN32
+            std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+            if (!file.is_open()) return;
+            std::streamsize fileSize = file.tellg();
+            file.seekg(0, std::ios::beg);
+            buffer.resize(static_cast<size_t>(fileSize));
+            if (fileSize > 0 && !file.read(reinterpret_cast<char*>(buffer.data()), fileSize)) {
+                buffer.clear();
+                return;
+            }
+            mappedData = buffer.data();
+            mappedSize = buffer.size();
+            opened = true;
+#else
+            int fd = ::open(filePath.c_str(), O_RDONLY);
+            if (fd < 0) return;
+
+            struct stat info;
+            if (::fstat(fd, &info) == 0) {
+                mappedSize = static_cast<size_t>(info.st_size);
+                opened = true;
+                if (mappedSize > 0) {
+                    void* address = ::mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (address == MAP_FAILED) {
+                        mappedSize = 0;
+                        opened = false;
+                    } else {
+                        mappedData = static_cast<const uint8_t*>(address);
+                        // dibaca berurutan dari awal sampai akhir
+                        ::madvise(address, mappedSize, MADV_SEQUENTIAL);
+                    }
+                }
+            }
+            ::close(fd);
+#endif
+        }
+
+        ~MappedFile() {
+#ifndef _WIN32
+            if (mappedData && mappedSize > 0) {
+                ::munmap(const_cast<uint8_t*>(mappedData), mappedSize);
+            }
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool isOpen() const { return opened; }
+        const uint8_t* data() const { return mappedData; }
+        size_t size() const { return mappedSize; }
+
+    private:
+        const uint8_t* mappedData = nullptr;
+        size_t mappedSize = 0;
+        bool opened = false;
+#ifdef _WIN32
+        std::vector<uint8_t> buffer;
+#endif
+    };
+} // namespace graphics
@@ -1,4 +1,6 @@
 #pragma once
+#include <array>
+#include <cstdint>
 #include <vector>
 #include "../math/Vector3.hpp"
 
@@ -7,5 +9,35 @@ namespace graphics {
     struct Mesh {
         std::vector<math::Vector3<T>> vertices;
         std::vector<std::vector<int>> faces;
+
+        // posisi terkuantisasi 16-bit per komponen, relatif ke AABB mesh (opsional, buat mesh yang gede banget).
+        // kalau terisi, vertices dikosongin dan posisi asli = quantizationOrigin + q * quantizationStep
+        std::vector<std::array<uint16_t, 3>> quantizedVertices;
+        math::Vector3<T> quantizationOrigin;
+        math::Vector3<T> quantizationStep;
+
+        bool isQuantized() const {
+            return !quantizedVertices.empty();
+        }
+
+        size_t vertexCount() const {
+            return isQuantized() ? quantizedVertices.size() : vertices.size();
+        }
+
+        bool empty() const {
+            return vertexCount() == 0;
+        }
+
+        math::Vector3<T> getVertex(size_t index) const {
+            if (!isQuantized()) {
+                return vertices[index];
+            }
+            const std::array<uint16_t, 3>& q = quantizedVertices[index];
+            return math::Vector3<T>(
+                quantizationOrigin.x + static_cast<T>(q[0]) * quantizationStep.x,
+                quantizationOrigin.y + static_cast<T>(q[1]) * quantizationStep.y,
+                quantizationOrigin.z + static_cast<T>(q[2]) * quantizationStep.z
+            );
+        }
     };
-} // namespace graphics
\ No newline at end of file
+} // namespace graphics
@@ -0,0 +1,118 @@
+#include "MeshCache.hpp"
+#include <iostream>
+
+#ifdef _WIN32
+#include <filesystem>
+#else
+#include <sys/stat.h>
+#endif
+
+namespace graphics {
+    template<typename T>
+    MeshCache<T>::MeshCache(size_t capacityBytes, LoadFunction loader)
+        : capacityBytes(capacityBytes), loader(std::move(loader)) {}
+
+    template<typename T>
+    bool MeshCache<T>::readFileStamp(const std::string& filePath, FileStamp& stamp) {
+#ifdef _WIN32
+        std::error_code error;
+        std::filesystem::path path(filePath);
+        auto modified = std::filesystem::last_write_time(path, error);
+        if (error) return false;
+        stamp.modifiedTime = static_cast<int64_t>(modified.time_since_epoch().count());
+        stamp.fileSize = static_cast<uint64_t>(std::filesystem::file_size(path, error));
+        return !error;
+#else
+        struct stat info;
+        if (::stat(filePath.c_str(), &info) != 0) return false;
+#ifdef __APPLE__
+        stamp.modifiedTime = static_cast<int64_t>(info.st_mtimespec.tv_sec) * 1000000000LL + info.st_mtimespec.tv_nsec;
+#else
+        stamp.modifiedTime = static_cast<int64_t>(info.st_mtim.tv_sec) * 1000000000LL + info.st_mtim.tv_nsec;
+#endif
+        stamp.fileSize = static_cast<uint64_t>(info.st_size);
+        return true;
+#endif
+    }
+
+    template<typename T>
+    size_t MeshCache<T>::estimateBytes(const Mesh<T>& mesh) {
+        size_t bytes = sizeof(Mesh<T>);
+        bytes += mesh.vertices.capacity() * sizeof(math::Vector3<T>);
+        bytes += mesh.quantizedVertices.capacity() * sizeof(mesh.quantizedVertices[0]);
+        bytes += mesh.faces.capacity() * sizeof(std::vector<int>);
+        for (const auto& face : mesh.faces) {
+            bytes += face.capacity() * sizeof(int);
+        }
+        return bytes;
+    }
+
+    template<typename T>
+    typename MeshCache<T>::MeshHandle MeshCache<T>::get(const std::string& filePath) {
+        FileStamp stamp;
+        bool hasStamp = readFileStamp(filePath, stamp);
+
+        auto found = lookup.find(filePath);
+        if (found != lookup.end()) {
+            if (hasStamp && found->second->stamp == stamp) {
+                entries.splice(entries.begin(), entries, found->second);
+                return found->second->mesh;
+            }
+            // file berubah (atau hilang) sejak di-cache
+            erase(found->second);
+        }
+
+        MeshHandle mesh = std::make_shared<const Mesh<T>>(loader(filePath));
+        size_t bytes = estimateBytes(*mesh);
+
+        // mesh kosong (gagal load) atau yang lebih gede dari kapasitas nggak di-cache
+        if (!hasStamp || mesh->empty() || bytes > capacityBytes) {
+            return mesh;
+        }
+
+        evictToFit(bytes);
+        entries.push_front(Entry{filePath, mesh, stamp, bytes});
+        lookup[filePath] = entries.begin();
+        usedBytes += bytes;
+        return mesh;
+    }
+
+    template<typename T>
+    bool MeshCache<T>::contains(const std::string& filePath) const {
+        return lookup.find(filePath) != lookup.end();
+    }
+
+    template<typename T>
+    void MeshCache<T>::invalidate(const std::string& filePath) {
+        auto found = lookup.find(filePath);
+        if (found != lookup.end()) {
+            erase(found->second);
+        }
+    }
+
+    template<typename T>
+    void MeshCache<T>::clear() {
+        entries.clear();
+        lookup.clear();
+        usedBytes = 0;
+    }
+
+    template<typename T>
+    void MeshCache<T>::erase(typename std::list<Entry>::iterator it) {
+        usedBytes -= it->bytes;
+        lookup.erase(it->filePath);
+        entries.erase(it);
+    }
+
+    template<typename T>
+    void MeshCache<T>::evictToFit(size_t incomingBytes) {
+        // handle yang masih dipegang di luar tetap valid, cache cuma ngelepas referensinya
+        while (!entries.empty() && usedBytes + incomingBytes > capacityBytes) {
+            erase(std::prev(entries.end()));
+        }
+    }
+
+    template class MeshCache<float>;
+    template class MeshCache<double>;
+
+} // namespace graphics
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "Mesh.hpp"
+
+namespace graphics {
+    // cache LRU mesh yang udah dimuat, dibatasi total ukuran byte.
+    // entry otomatis invalid kalau mtime/ukuran file berubah. Bukan thread-safe (dipakai dari thread UI).
+    template<typename T>
+    class MeshCache {
+    public:
+        using MeshHandle = std::shared_ptr<const Mesh<T>>;
+        using LoadFunction = std::function<Mesh<T>(const std::string&)>;
+
+        MeshCache(size_t capacityBytes, LoadFunction loader);
+
+        // cache hit cuma stat file + pindahin entry ke depan, tanpa alokasi
+        MeshHandle get(const std::string& filePath);
+        bool contains(const std::string& filePath) const;
+        void invalidate(const std::string& filePath);
+        void clear();
+
+        size_t getUsedBytes() const { return usedBytes; }
+        size_t getCapacityBytes() const { return capacityBytes; }
+        size_t getEntryCount() const { return entries.size(); }
+
+        static size_t estimateBytes(const Mesh<T>& mesh);
+
+    private:
+        struct FileStamp {
+            int64_t modifiedTime = 0;
+            uint64_t fileSize = 0;
+            bool operator==(const FileStamp& other) const {
+                return modifiedTime == other.modifiedTime && fileSize == other.fileSize;
+            }
+        };
+
+        struct Entry {
+            std::string filePath;
+            MeshHandle mesh;
+            FileStamp stamp;
+            size_t bytes;
+        };
+
+        // depan = paling baru dipakai
+        std::list<Entry> entries;
+        std::unordered_map<std::string, typename std::list<Entry>::iterator> lookup;
+        size_t capacityBytes;
+        size_t usedBytes = 0;
+        LoadFunction loader;
+
+        static bool readFileStamp(const std::string& filePath, FileStamp& stamp);
+        void erase(typename std::list<Entry>::iterator it);
+        void evictToFit(size_t incomingBytes);
+    };
+} // namespace graphics
@@ -0,0 +1,315 @@
+#include "MeshCodec.hpp"
+#include "MeshQuantizer.hpp"
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace graphics {
+    namespace {
+        const char MAGIC[4] = {'Q', 'M', 'S', 'H'};
+        const uint32_t VERSION = 1;
+        const size_t HEADER_SIZE = 4 + 4 * 3 + 8 * 6 + 4 * 2;
+        // slot cache index yang baru dipakai; index yang sama dengan face sebelumnya (edge bersama) cuma makan 1 byte
+        const int INDEX_CACHE_SIZE = 8;
+
+        uint32_t zigzagEncode(int32_t value) {
+            return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+        }
+        int32_t zigzagDecode(uint32_t value) {
+            return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+        }
+
+        class ByteWriter {
+        public:
+            std::vector<uint8_t> bytes;
+
+            void u32(uint32_t value) {
+                for (int i = 0; i < 4; ++i) bytes.push_back(static_cast<uint8_t>(value >> (8 * i)));
+            }
+            void f64(double value) {
+                uint64_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                for (int i = 0; i < 8; ++i) bytes.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+            }
+            void varint(uint32_t value) {
+                while (value >= 0x80) {
+                    bytes.push_back(static_cast<uint8_t>(value | 0x80));
+                    value >>= 7;
+                }
+                bytes.push_back(static_cast<uint8_t>(value));
+            }
+        };
+
+        class ByteReader {
+        public:
+            ByteReader(const uint8_t* data, size_t size) : cursor(data), end(data + size) {}
+
+            uint32_t u32() {
+                require(4);
+                uint32_t value = static_cast<uint32_t>(cursor[0]) | (static_cast<uint32_t>(cursor[1]) << 8) |
+                                 (static_cast<uint32_t>(cursor[2]) << 16) | (static_cast<uint32_t>(cursor[3]) << 24);
+                cursor += 4;
+                return value;
+            }
+            double f64() {
+                require(8);
+                uint64_t bits = 0;
+                for (int i = 0; i < 8; ++i) bits |= static_cast<uint64_t>(cursor[i]) << (8 * i);
+                cursor += 8;
+                double value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+            uint32_t varint() {
+                // jalur cepat: mayoritas delta muat di 1 byte
+                if (cursor < end && *cursor < 0x80) {
+                    return *cursor++;
+                }
+                uint32_t value = 0;
+                for (int shift = 0; shift < 35; shift += 7) {
+                    require(1);
+                    uint8_t byte = *cursor++;
+                    value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                    if (byte < 0x80) return value;
+                }
+                throw std::runtime_error("[MeshCodec] varint tidak valid.");
+            }
+            const uint8_t* position() const { return cursor; }
+            size_t remaining() const { return static_cast<size_t>(end - cursor); }
+            void skip(size_t count) { require(count); cursor += count; }
+
+        private:
+            const uint8_t* cursor;
+            const uint8_t* end;
+
+            void require(size_t count) const {
+                if (static_cast<size_t>(end - cursor) < count) {
+                    throw std::runtime_error("[MeshCodec] data terpotong.");
+                }
+            }
+        };
+    }
+
+    template<typename T>
+    std::vector<uint8_t> MeshCodec<T>::encode(const Mesh<T>& mesh) {
+        Mesh<T> quantized;
+        if (mesh.isQuantized()) {
+            quantized.quantizedVertices = mesh.quantizedVertices;
+            quantized.quantizationOrigin = mesh.quantizationOrigin;
+            quantized.quantizationStep = mesh.quantizationStep;
+        } else {
+            quantized.vertices = mesh.vertices;
+            MeshQuantizer<T>::quantize(quantized);
+        }
+
+        ByteWriter vertexStream;
+        vertexStream.bytes.reserve(quantized.quantizedVertices.size() * 3);
+        std::array<int32_t, 3> previous = {0, 0, 0};
+        for (const auto& q : quantized.quantizedVertices) {
+            for (int c = 0; c < 3; ++c) {
+                vertexStream.varint(zigzagEncode(static_cast<int32_t>(q[c]) - previous[c]));
+                previous[c] = q[c];
+            }
+        }
+
+        ByteWriter faceStream;
+        faceStream.bytes.reserve(mesh.faces.size() * 4);
+        std::array<int32_t, INDEX_CACHE_SIZE> cache;
+        cache.fill(-1);
+        int cachePos = 0;
+        int32_t lastIndex = 0;
+        for (const auto& face : mesh.faces) {
+            if (face.size() < 3) {
+                throw std::runtime_error("[MeshCodec] face dengan vertex kurang dari 3.");
+            }
+            faceStream.varint(static_cast<uint32_t>(face.size() - 3));
+            for (int index : face) {
+                int slot = -1;
+                for (int j = 0; j < INDEX_CACHE_SIZE; ++j) {
+                    if (cache[j] == index) {
+                        slot = j;
+                        break;
+                    }
+                }
+                if (slot >= 0) {
+                    faceStream.varint(static_cast<uint32_t>(slot));
+                } else {
+                    faceStream.varint(INDEX_CACHE_SIZE + zigzagEncode(index - lastIndex));
+                }
+                lastIndex = index;
+                cache[cachePos] = index;
+                cachePos = (cachePos + 1) % INDEX_CACHE_SIZE;
+            }
+        }
+
+        ByteWriter out;
+        out.bytes.reserve(HEADER_SIZE + vertexStream.bytes.size() + faceStream.bytes.size());
+        out.bytes.insert(out.bytes.end(), MAGIC, MAGIC + 4);
+        out.u32(VERSION);
+        out.u32(static_cast<uint32_t>(quantized.quantizedVertices.size()));
+        out.u32(static_cast<uint32_t>(mesh.faces.size()));
+        out.f64(quantized.quantizationOrigin.x);
+        out.f64(quantized.quantizationOrigin.y);
+        out.f64(quantized.quantizationOrigin.z);
+        out.f64(quantized.quantizationStep.x);
+        out.f64(quantized.quantizationStep.y);
+        out.f64(quantized.quantizationStep.z);
+        out.u32(static_cast<uint32_t>(vertexStream.bytes.size()));
+        out.u32(static_cast<uint32_t>(faceStream.bytes.size()));
+        out.bytes.insert(out.bytes.end(), vertexStream.bytes.begin(), vertexStream.bytes.end());
+        out.bytes.insert(out.bytes.end(), faceStream.bytes.begin(), faceStream.bytes.end());
+        return out.bytes;
+    }
+
+    template<typename T>
+    Mesh<T> MeshCodec<T>::decode(const uint8_t* data, size_t size, bool keepQuantized) {
+        if (size < HEADER_SIZE || std::memcmp(data, MAGIC, 4) != 0) {
+            throw std::runtime_error("[MeshCodec] bukan file .qmesh.");
+        }
+
+        ByteReader reader(data, size);
+        reader.skip(4);
+        if (reader.u32() != VERSION) {
+            throw std::runtime_error("[MeshCodec] versi format tidak didukung.");
+        }
+        uint32_t vertexCount = reader.u32();
+        uint32_t faceCount = reader.u32();
+
+        Mesh<T> mesh;
+        mesh.quantizationOrigin.x = static_cast<T>(reader.f64());
+        mesh.quantizationOrigin.y = static_cast<T>(reader.f64());
+        mesh.quantizationOrigin.z = static_cast<T>(reader.f64());
+        mesh.quantizationStep.x = static_cast<T>(reader.f64());
+        mesh.quantizationStep.y = static_cast<T>(reader.f64());
+        mesh.quantizationStep.z = static_cast<T>(reader.f64());
+        uint32_t vertexStreamSize = reader.u32();
+        uint32_t faceStreamSize = reader.u32();
+        if (static_cast<size_t>(vertexStreamSize) + faceStreamSize > size - HEADER_SIZE) {
+            throw std::runtime_error("[MeshCodec] data terpotong.");
+        }
+        // jumlah dari header belum bisa dipercaya: cek dulu terhadap ukuran stream sebelum alokasi. Tiap vertex
+        // minimal 3 byte (3 varint), tiap face minimal 4 byte (varint ukuran + 3 index)
+        if (static_cast<uint64_t>(vertexCount) * 3 > vertexStreamSize ||
+            static_cast<uint64_t>(faceCount) * 4 > faceStreamSize) {
+            throw std::runtime_error("[MeshCodec] data terpotong.");
+        }
+
+        // decode langsung ke buffer mesh yang ukurannya udah diketahui dari header
+        ByteReader vertexReader(reader.position(), vertexStreamSize);
+        std::array<int32_t, 3> previous = {0, 0, 0};
+        if (keepQuantized) {
+            mesh.quantizedVertices.resize(vertexCount);
+        } else {
+            mesh.vertices.resize(vertexCount);
+        }
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                previous[c] += zigzagDecode(vertexReader.varint());
+                if (previous[c] < 0 || previous[c] > 65535) {
+                    throw std::runtime_error("[MeshCodec] koordinat vertex di luar jangkauan.");
+                }
+            }
+            if (keepQuantized) {
+                mesh.quantizedVertices[i] = {
+                    static_cast<uint16_t>(previous[0]), static_cast<uint16_t>(previous[1]), static_cast<uint16_t>(previous[2])
+                };
+            } else {
+                mesh.vertices[i] = math::Vector3<T>(
+                    mesh.quantizationOrigin.x + static_cast<T>(previous[0]) * mesh.quantizationStep.x,
+                    mesh.quantizationOrigin.y + static_cast<T>(previous[1]) * mesh.quantizationStep.y,
+                    mesh.quantizationOrigin.z + static_cast<T>(previous[2]) * mesh.quantizationStep.z
+                );
+            }
+        }
+
+        ByteReader faceReader(reader.position() + vertexStreamSize, faceStreamSize);
+        std::array<int32_t, INDEX_CACHE_SIZE> cache;
+        cache.fill(-1);
+        int cachePos = 0;
+        int32_t lastIndex = 0;
+        mesh.faces.resize(faceCount);
+        for (uint32_t f = 0; f < faceCount; ++f) {
+            std::vector<int>& face = mesh.faces[f];
+            // tiap index minimal 1 byte, jadi ukuran face dibatasi sisa stream
+            uint32_t extra = faceReader.varint();
+            if (static_cast<uint64_t>(extra) + 3 > faceReader.remaining()) {
+                throw std::runtime_error("[MeshCodec] data terpotong.");
+            }
+            face.resize(static_cast<size_t>(extra) + 3);
+            for (int& index : face) {
+                uint32_t code = faceReader.varint();
+                if (code < static_cast<uint32_t>(INDEX_CACHE_SIZE)) {
+                    index = cache[code];
+                } else {
+                    index = lastIndex + zigzagDecode(code - INDEX_CACHE_SIZE);
+                }
+                if (index < 0 || index >= static_cast<int32_t>(vertexCount)) {
+                    throw std::runtime_error("[MeshCodec] index vertex tidak valid.");
+                }
+                lastIndex = index;
+                cache[cachePos] = index;
+                cachePos = (cachePos + 1) % INDEX_CACHE_SIZE;
+            }
+        }
+
+        if (!keepQuantized) {
+            mesh.quantizationOrigin = math::Vector3<T>();
+            mesh.quantizationStep = math::Vector3<T>();
+        }
+        return mesh;
+    }
+
+    template<typename T>
+    bool MeshCodec<T>::saveToFile(const Mesh<T>& mesh, const std::string& filePath) {
+        std::vector<uint8_t> bytes = encode(mesh);
+        std::ofstream file(filePath, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "Error: Tidak dapat menulis file " << filePath << std::endl;
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return static_cast<bool>(file);
+    }
+
+    template<typename T>
+    Mesh<T> MeshCodec<T>::loadFromFile(const std::string& filePath, bool keepQuantized) {
+        std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            std::cerr << "Error: Tidak dapat membuka file " << filePath << std::endl;
+            return Mesh<T>();
+        }
+
+        std::streamsize size = file.tellg();
+        file.seekg(0, std::ios::beg);
+        std::vector<uint8_t> bytes(static_cast<size_t>(size));
+        if (!file.read(reinterpret_cast<char*>(bytes.data()), size)) {
+            throw std::runtime_error("[MeshCodec] gagal membaca file.");
+        }
+
+        return decode(bytes.data(), bytes.size(), keepQuantized);
+    }
+
+    template<typename T>
+    bool MeshCodec<T>::readHeaderCounts(const std::string& filePath, size_t& vertexCount, size_t& faceCount) {
+        std::ifstream file(filePath, std::ios::binary);
+        uint8_t header[16];
+        if (!file.read(reinterpret_cast<char*>(header), sizeof(header)) || std::memcmp(header, MAGIC, 4) != 0) {
+            return false;
+        }
+
+        ByteReader reader(header, sizeof(header));
+        reader.skip(4);
+        if (reader.u32() != VERSION) {
+            return false;
+        }
+        vertexCount = reader.u32();
+        faceCount = reader.u32();
+        return true;
+    }
+
+    template class MeshCodec<float>;
+    template class MeshCodec<double>;
+
+} // namespace graphics
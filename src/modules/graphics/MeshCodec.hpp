@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Mesh.hpp"
+
+namespace graphics {
+    // Format mesh terkompresi (.qmesh), semua little-endian:
+    //   header : "QMSH", version, vertexCount, faceCount, origin[3], step[3] (double), ukuran stream vertex & face
+    //   vertex : posisi 16-bit relatif AABB, tiap komponen disimpan sebagai delta dari vertex sebelumnya (zigzag varint)
+    //   face   : (jumlah index - 3), lalu tiap index = slot cache index terakhir atau delta dari index sebelumnya
+    template<typename T>
+    class MeshCodec {
+    public:
+        static constexpr const char* FILE_EXTENSION = ".qmesh";
+
+        static std::vector<uint8_t> encode(const Mesh<T>& mesh);
+        static Mesh<T> decode(const uint8_t* data, size_t size, bool keepQuantized = false);
+
+        static bool saveToFile(const Mesh<T>& mesh, const std::string& filePath);
+        static Mesh<T> loadFromFile(const std::string& filePath, bool keepQuantized = false);
+        static bool readHeaderCounts(const std::string& filePath, size_t& vertexCount, size_t& faceCount);
+    };
+} // namespace graphics
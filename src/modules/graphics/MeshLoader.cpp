@@ -0,0 +1,64 @@
+#include "MeshLoader.hpp"
+#include "ObjLoader.hpp"
+#include "StlLoader.hpp"
+#include "PlyLoader.hpp"
+#include "MeshCodec.hpp"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+
+namespace graphics {
+    namespace {
+        std::string lowercaseExtension(const std::string& filePath) {
+            std::string extension = std::filesystem::path(filePath).extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return extension;
+        }
+    }
+
+    template<typename T>
+    Mesh<T> MeshLoader<T>::loadFromFile(const std::string& filePath) {
+        std::string extension = lowercaseExtension(filePath);
+
+        if (extension == ".stl") {
+            return StlLoader<T>::loadStl(filePath);
+        }
+        if (extension == ".ply") {
+            return PlyLoader<T>::loadPly(filePath);
+        }
+        if (extension == MeshCodec<T>::FILE_EXTENSION) {
+            return MeshCodec<T>::loadFromFile(filePath);
+        }
+        return ObjLoader<T>::loadObj(filePath);
+    }
+
+    template<typename T>
+    bool MeshLoader<T>::isSupportedExtension(const std::string& extension) {
+        std::string lower = lowercaseExtension("file" + extension);
+        return lower == ".obj" || lower == ".stl" || lower == ".ply" || lower == MeshCodec<T>::FILE_EXTENSION;
+    }
+
+    template<typename T>
+    bool MeshLoader<T>::readHeaderCounts(const std::string& filePath, size_t& vertexCount, size_t& faceCount) {
+        std::string extension = lowercaseExtension(filePath);
+
+        if (extension == ".stl") {
+            return StlLoader<T>::readHeaderCounts(filePath, vertexCount, faceCount);
+        }
+        if (extension == ".ply") {
+            return PlyLoader<T>::readHeaderCounts(filePath, vertexCount, faceCount);
+        }
+        if (extension == MeshCodec<T>::FILE_EXTENSION) {
+            return MeshCodec<T>::readHeaderCounts(filePath, vertexCount, faceCount);
+        }
+        if (extension == ".obj") {
+            return ObjLoader<T>::readHeaderCounts(filePath, vertexCount, faceCount);
+        }
+        return false;
+    }
+
+    template class MeshLoader<float>;
+    template class MeshLoader<double>;
+
+} // namespace graphics
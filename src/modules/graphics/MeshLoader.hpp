@@ -0,0 +1,15 @@
+#pragma once
+#include <string>
+#include "Mesh.hpp"
+
+namespace graphics {
+    // milih loader berdasarkan ekstensi file (.obj, .stl, .ply, .qmesh)
+    template<typename T>
+    class MeshLoader {
+    public:
+        static Mesh<T> loadFromFile(const std::string& filePath);
+        static bool isSupportedExtension(const std::string& extension);
+        // jumlah vertex/face dari header file tanpa memuat mesh-nya
+        static bool readHeaderCounts(const std::string& filePath, size_t& vertexCount, size_t& faceCount);
+    };
+} // namespace graphics
@@ -0,0 +1,75 @@
+#include "MeshQuantizer.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace graphics {
+    template<typename T>
+    void MeshQuantizer<T>::quantize(Mesh<T>& mesh) {
+        if (mesh.vertices.empty()) {
+            return;
+        }
+
+        math::Vector3<T> minBound = mesh.vertices[0];
+        math::Vector3<T> maxBound = mesh.vertices[0];
+        for (const auto& v : mesh.vertices) {
+            minBound.x = std::min(minBound.x, v.x);
+            minBound.y = std::min(minBound.y, v.y);
+            minBound.z = std::min(minBound.z, v.z);
+            maxBound.x = std::max(maxBound.x, v.x);
+            maxBound.y = std::max(maxBound.y, v.y);
+            maxBound.z = std::max(maxBound.z, v.z);
+        }
+
+        const T levels = static_cast<T>(65535);
+        math::Vector3<T> extent = maxBound - minBound;
+        mesh.quantizationOrigin = minBound;
+        mesh.quantizationStep = extent * (static_cast<T>(1) / levels);
+
+        // sumbu yang extent-nya nol cukup di-quantize ke 0
+        T invX = extent.x > static_cast<T>(0) ? levels / extent.x : static_cast<T>(0);
+        T invY = extent.y > static_cast<T>(0) ? levels / extent.y : static_cast<T>(0);
+        T invZ = extent.z > static_cast<T>(0) ? levels / extent.z : static_cast<T>(0);
+
+        mesh.quantizedVertices.resize(mesh.vertices.size());
+        for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+            const math::Vector3<T>& v = mesh.vertices[i];
+            mesh.quantizedVertices[i] = {
+                static_cast<uint16_t>(std::lround(std::clamp((v.x - minBound.x) * invX, static_cast<T>(0), levels))),
+                static_cast<uint16_t>(std::lround(std::clamp((v.y - minBound.y) * invY, static_cast<T>(0), levels))),
+                static_cast<uint16_t>(std::lround(std::clamp((v.z - minBound.z) * invZ, static_cast<T>(0), levels)))
+            };
+        }
+
+        mesh.vertices.clear();
+        mesh.vertices.shrink_to_fit();
+    }
+
+    template<typename T>
+    void MeshQuantizer<T>::dequantize(Mesh<T>& mesh) {
+        if (!mesh.isQuantized()) {
+            return;
+        }
+
+        std::vector<math::Vector3<T>> vertices;
+        vertices.reserve(mesh.quantizedVertices.size());
+        for (size_t i = 0; i < mesh.quantizedVertices.size(); ++i) {
+            vertices.push_back(mesh.getVertex(i));
+        }
+
+        mesh.vertices = std::move(vertices);
+        mesh.quantizedVertices.clear();
+        mesh.quantizedVertices.shrink_to_fit();
+    }
+
+    template<typename T>
+    math::Matrix4<T> MeshQuantizer<T>::dequantizationMatrix(const Mesh<T>& mesh) {
+        if (!mesh.isQuantized()) {
+            return math::Matrix4<T>::identity();
+        }
+        return math::Matrix4<T>::translation(mesh.quantizationOrigin) * math::Matrix4<T>::scale(mesh.quantizationStep);
+    }
+
+    template class MeshQuantizer<float>;
+    template class MeshQuantizer<double>;
+
+} // namespace graphics
@@ -0,0 +1,18 @@
+#pragma once
+#include "Mesh.hpp"
+#include "../math/Matrix4.hpp"
+
+namespace graphics {
+    template<typename T>
+    class MeshQuantizer {
+    public:
+        // ubah vertices jadi 16-bit per komponen relatif ke AABB, vertices full precision dibuang
+        static void quantize(Mesh<T>& mesh);
+        // balikin ke vertices full precision (hasilnya udah kena error kuantisasi)
+        static void dequantize(Mesh<T>& mesh);
+
+        // matriks yang ngubah koordinat terkuantisasi (0..65535) ke koordinat model,
+        // jadi dekuantisasi bisa digabung ke model matrix: M * D * q
+        static math::Matrix4<T> dequantizationMatrix(const Mesh<T>& mesh);
+    };
+} // namespace graphics
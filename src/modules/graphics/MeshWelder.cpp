@@ -0,0 +1,113 @@
+#include "MeshWelder.hpp"
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace graphics {
+    namespace {
+        // 21 bit per sumbu cukup; kalau wrap pun aman karena tetap dicek jaraknya
+        uint64_t packCell(int64_t cx, int64_t cy, int64_t cz) {
+            const uint64_t mask = (1ull << 21) - 1;
+            return (static_cast<uint64_t>(cx) & mask) |
+                   ((static_cast<uint64_t>(cy) & mask) << 21) |
+                   ((static_cast<uint64_t>(cz) & mask) << 42);
+        }
+    }
+
+    template<typename T>
+    WeldResult MeshWelder<T>::weld(Mesh<T>& mesh, T tolerance) {
+        WeldResult result;
+        result.originalVertexCount = mesh.vertices.size();
+
+        if (mesh.vertices.empty()) {
+            return result;
+        }
+
+        // ukuran sel = tolerance, jadi vertex yang cukup dekat pasti ada di sel tetangga (3x3x3)
+        T cellSize = tolerance > static_cast<T>(0) ? tolerance : static_cast<T>(1);
+        T invCellSize = static_cast<T>(1) / cellSize;
+        T toleranceSquared = tolerance * tolerance;
+
+        std::vector<math::Vector3<T>> weldedVertices;
+        weldedVertices.reserve(mesh.vertices.size());
+        std::vector<int> remap(mesh.vertices.size());
+
+        // tiap sel nyimpen head dari linked list vertex hasil weld di sel itu
+        std::unordered_map<uint64_t, int> cellHeads;
+        cellHeads.reserve(mesh.vertices.size());
+        std::vector<int> nextInCell;
+        nextInCell.reserve(mesh.vertices.size());
+
+        for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+            const math::Vector3<T>& v = mesh.vertices[i];
+            int64_t cx = static_cast<int64_t>(std::floor(v.x * invCellSize));
+            int64_t cy = static_cast<int64_t>(std::floor(v.y * invCellSize));
+            int64_t cz = static_cast<int64_t>(std::floor(v.z * invCellSize));
+
+            int match = -1;
+            for (int dz = -1; dz <= 1 && match < 0; ++dz) {
+                for (int dy = -1; dy <= 1 && match < 0; ++dy) {
+                    for (int dx = -1; dx <= 1 && match < 0; ++dx) {
+                        auto it = cellHeads.find(packCell(cx + dx, cy + dy, cz + dz));
+                        if (it == cellHeads.end()) continue;
+
+                        for (int candidate = it->second; candidate >= 0; candidate = nextInCell[candidate]) {
+                            math::Vector3<T> diff = weldedVertices[candidate] - v;
+                            if (diff.dot(diff) <= toleranceSquared) {
+                                match = candidate;
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+
+            if (match < 0) {
+                match = static_cast<int>(weldedVertices.size());
+                weldedVertices.push_back(v);
+
+                uint64_t key = packCell(cx, cy, cz);
+                auto it = cellHeads.find(key);
+                nextInCell.push_back(it != cellHeads.end() ? it->second : -1);
+                cellHeads[key] = match;
+            }
+            remap[i] = match;
+        }
+
+        std::vector<std::vector<int>> weldedFaces;
+        weldedFaces.reserve(mesh.faces.size());
+
+        for (const auto& face : mesh.faces) {
+            std::vector<int> newFace;
+            newFace.reserve(face.size());
+
+            for (int index : face) {
+                if (index < 0 || index >= static_cast<int>(remap.size())) continue;
+                int mapped = remap[index];
+                if (newFace.empty() || newFace.back() != mapped) {
+                    newFace.push_back(mapped);
+                }
+            }
+            while (newFace.size() > 1 && newFace.front() == newFace.back()) {
+                newFace.pop_back();
+            }
+
+            if (newFace.size() >= 3) {
+                weldedFaces.push_back(std::move(newFace));
+            } else {
+                result.removedFaceCount++;
+            }
+        }
+
+        mesh.vertices = std::move(weldedVertices);
+        mesh.vertices.shrink_to_fit();
+        mesh.faces = std::move(weldedFaces);
+        result.weldedVertexCount = mesh.vertices.size();
+        return result;
+    }
+
+    template class MeshWelder<float>;
+    template class MeshWelder<double>;
+
+} // namespace graphics
@@ -0,0 +1,24 @@
+#pragma once
+#include <cstddef>
+#include "Mesh.hpp"
+
+namespace graphics {
+    // hasil welding, buat dilaporin ke user
+    struct WeldResult {
+        size_t originalVertexCount = 0;
+        size_t weldedVertexCount = 0;
+        size_t removedFaceCount = 0;
+
+        size_t removedVertexCount() const {
+            return originalVertexCount - weldedVertexCount;
+        }
+    };
+
+    template<typename T>
+    class MeshWelder {
+    public:
+        // gabungin vertex yang jaraknya <= tolerance (pakai spatial hash), terus remap index face.
+        // face yang jadi degenerate (< 3 vertex beda) dibuang.
+        static WeldResult weld(Mesh<T>& mesh, T tolerance);
+    };
+} // namespace graphics
@@ -0,0 +1,287 @@
+#include "ModelIndex.hpp"
+#include "MeshLoader.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace graphics {
+    namespace {
+        bool sameFile(const ModelFileInfo& a, const ModelFileInfo& b) {
+            return a.fileName == b.fileName && a.fileSize == b.fileSize && a.modifiedTime == b.modifiedTime;
+        }
+
+        std::vector<ModelFileInfo>::iterator findByName(std::vector<ModelFileInfo>& files, const std::string& fileName) {
+            return std::lower_bound(files.begin(), files.end(), fileName,
+                [](const ModelFileInfo& info, const std::string& name) { return info.fileName < name; });
+        }
+    }
+
+    ModelIndex::ModelIndex(const std::string& directory) : directory(directory) {}
+
+    ModelIndex::~ModelIndex() {
+        stop();
+    }
+
+    void ModelIndex::start() {
+        if (running.exchange(true)) return;
+#ifdef __linux__
+        if (pipe2(wakePipe, O_CLOEXEC) != 0) {
+            wakePipe[0] = wakePipe[1] = -1;
+        }
+#endif
+        worker = std::thread(&ModelIndex::run, this);
+    }
+
+    void ModelIndex::stop() {
+        if (!running.exchange(false)) return;
+#ifdef __linux__
+        if (wakePipe[1] >= 0) {
+            char wake = 1;
+            (void)!write(wakePipe[1], &wake, 1);
+        }
+#endif
+        if (worker.joinable()) {
+            worker.join();
+        }
+#ifdef __linux__
+        for (int& fd : wakePipe) {
+            if (fd >= 0) close(fd);
+            fd = -1;
+        }
+#endif
+    }
+
+    ModelIndex::Snapshot ModelIndex::snapshot() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return published ? published : std::make_shared<const std::vector<ModelFileInfo>>();
+    }
+
+    void ModelIndex::publishLocked() {
+        published = std::make_shared<const std::vector<ModelFileInfo>>(files);
+        version.fetch_add(1, std::memory_order_release);
+    }
+
+    void ModelIndex::run() {
+#ifdef __linux__
+        // watch dipasang sebelum scan awal: di folder besar scan-nya bisa lama, dan perubahan selama itu tetap
+        // antri sebagai event. Event buat file yang sudah ikut ke-scan aman, updateFile/removeFile idempoten
+        int inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        int watch = -1;
+        if (inotifyFd >= 0) {
+            watch = inotify_add_watch(inotifyFd, directory.c_str(),
+                                      IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO |
+                                      IN_DELETE_SELF | IN_MOVE_SELF);
+        }
+#endif
+
+        scanning.store(true, std::memory_order_release);
+        rescan();
+        scanning.store(false, std::memory_order_release);
+
+#ifdef __linux__
+        if (watch >= 0 && wakePipe[0] >= 0) {
+            alignas(inotify_event) char buffer[4096];
+            bool watchLost = false;
+
+            while (running && !watchLost) {
+                pollfd fds[2] = {{inotifyFd, POLLIN, 0}, {wakePipe[0], POLLIN, 0}};
+                if (poll(fds, 2, -1) < 0) {
+                    if (errno == EINTR) continue;
+                    break;
+                }
+                if (fds[1].revents != 0) break;
+
+                // satu publish per batch event (copy 1000 file ke folder = beberapa publish, bukan 1000)
+                bool needRescan = false;
+                bool changed = false;
+                ssize_t length;
+                while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0) {
+                    for (char* cursor = buffer; cursor < buffer + length;) {
+                        const inotify_event* event = reinterpret_cast<const inotify_event*>(cursor);
+                        if (event->mask & IN_Q_OVERFLOW) {
+                            // antrian event kernel penuh, ada perubahan yang kelewat
+                            needRescan = true;
+                        } else if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) {
+                            watchLost = true;
+                        } else if (event->len > 0 && !(event->mask & IN_ISDIR)) {
+                            if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                                changed |= removeFile(event->name);
+                            } else {
+                                changed |= updateFile(event->name);
+                            }
+                        }
+                        cursor += sizeof(inotify_event) + event->len;
+                    }
+                }
+                if (needRescan) {
+                    rescan();
+                } else if (changed) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    publishLocked();
+                }
+            }
+        } else {
+            std::cerr << "[ModelIndex] inotify tidak tersedia untuk " << directory << ", pakai rescan berkala." << std::endl;
+        }
+
+        if (inotifyFd >= 0) close(inotifyFd);
+#endif
+
+        // fallback: folder belum ada, watch hilang, atau platform tanpa inotify
+        while (running) {
+            waitForStop(POLL_INTERVAL_MS);
+            if (!running) break;
+            rescan();
+        }
+    }
+
+    void ModelIndex::rescan() {
+        std::vector<ModelFileInfo> scanned;
+        std::error_code error;
+        std::filesystem::directory_iterator it(directory, error);
+        for (; !error && it != std::filesystem::directory_iterator(); it.increment(error)) {
+            std::string fileName = it->path().filename().string();
+            ModelFileInfo info;
+            if (MeshLoader<float>::isSupportedExtension(it->path().extension().string()) &&
+                readFileInfo(fileName, info)) {
+                scanned.push_back(std::move(info));
+            }
+        }
+        std::sort(scanned.begin(), scanned.end(),
+                  [](const ModelFileInfo& a, const ModelFileInfo& b) { return a.fileName < b.fileName; });
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            bool changed = scanned.size() != files.size();
+            for (auto& info : scanned) {
+                auto old = findByName(files, info.fileName);
+                if (old != files.end() && sameFile(*old, info)) {
+                    // file yang nggak berubah nggak perlu di-sniff ulang
+                    info.headerRead = old->headerRead;
+                    info.vertexCount = old->vertexCount;
+                    info.faceCount = old->faceCount;
+                } else {
+                    changed = true;
+                }
+            }
+            if (changed) {
+                files.swap(scanned);
+                publishLocked();
+            }
+        }
+
+        sniffPendingHeaders();
+    }
+
+    void ModelIndex::sniffPendingHeaders() {
+        std::vector<ModelFileInfo> pending;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (const auto& info : files) {
+                if (!info.headerRead) pending.push_back(info);
+            }
+        }
+
+        bool unpublished = false;
+        auto lastPublish = std::chrono::steady_clock::now();
+        for (auto& info : pending) {
+            if (!running) break;
+            sniffHeader(info);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            auto entry = findByName(files, info.fileName);
+            // bisa saja file-nya sudah berubah/terhapus selama di-sniff
+            if (entry != files.end() && sameFile(*entry, info)) {
+                *entry = info;
+                unpublished = true;
+            }
+            auto now = std::chrono::steady_clock::now();
+            if (unpublished && now - lastPublish >= std::chrono::milliseconds(SNIFF_PUBLISH_INTERVAL_MS)) {
+                publishLocked();
+                unpublished = false;
+                lastPublish = now;
+            }
+        }
+        if (unpublished) {
+            std::lock_guard<std::mutex> lock(mutex);
+            publishLocked();
+        }
+    }
+
+    bool ModelIndex::updateFile(const std::string& fileName) {
+        ModelFileInfo info;
+        if (!MeshLoader<float>::isSupportedExtension(std::filesystem::path(fileName).extension().string())) {
+            return false;
+        }
+        if (!readFileInfo(fileName, info)) {
+            return removeFile(fileName);
+        }
+        sniffHeader(info);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto entry = findByName(files, fileName);
+        if (entry != files.end() && entry->fileName == fileName) {
+            *entry = std::move(info);
+        } else {
+            files.insert(entry, std::move(info));
+        }
+        return true;
+    }
+
+    bool ModelIndex::removeFile(const std::string& fileName) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto entry = findByName(files, fileName);
+        if (entry == files.end() || entry->fileName != fileName) {
+            return false;
+        }
+        files.erase(entry);
+        return true;
+    }
+
+    bool ModelIndex::readFileInfo(const std::string& fileName, ModelFileInfo& info) const {
+        std::error_code error;
+        std::filesystem::path path = std::filesystem::path(directory) / fileName;
+        if (!std::filesystem::is_regular_file(path, error)) return false;
+
+        info.fileName = fileName;
+        info.fileSize = static_cast<uint64_t>(std::filesystem::file_size(path, error));
+        if (error) return false;
+        info.modifiedTime = static_cast<int64_t>(std::filesystem::last_write_time(path, error).time_since_epoch().count());
+        return !error;
+    }
+
+    void ModelIndex::sniffHeader(ModelFileInfo& info) const {
+        size_t vertexCount = 0;
+        size_t faceCount = 0;
+        std::string path = (std::filesystem::path(directory) / info.fileName).string();
+        if (MeshLoader<float>::readHeaderCounts(path, vertexCount, faceCount)) {
+            info.vertexCount = static_cast<long long>(vertexCount);
+            info.faceCount = static_cast<long long>(faceCount);
+        }
+        info.headerRead = true;
+    }
+
+    void ModelIndex::waitForStop(int milliseconds) {
+#ifdef __linux__
+        if (wakePipe[0] >= 0) {
+            pollfd fd = {wakePipe[0], POLLIN, 0};
+            poll(&fd, 1, milliseconds);
+            return;
+        }
+#endif
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+        while (running && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+    }
+
+} // namespace graphics
@@ -0,0 +1,71 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace graphics {
+    struct ModelFileInfo {
+        std::string fileName;
+        uint64_t fileSize = 0;
+        int64_t modifiedTime = 0;
+        bool headerRead = false;   // false = header belum di-sniff
+        long long vertexCount = -1; // -1 = tidak diketahui (mis. STL ASCII, OBJ kegedean)
+        long long faceCount = -1;
+    };
+
+    // Index isi folder model yang dibangun di thread background:
+    // scan sekali (nama + ukuran langsung dipublish, jumlah vertex/face nyusul dari header),
+    // lalu folder dipantau pakai inotify (Linux) atau rescan berkala di platform lain.
+    // UI cukup cek getVersion() tiap frame dan ambil snapshot() kalau berubah
+    class ModelIndex {
+    public:
+        explicit ModelIndex(const std::string& directory = "models");
+        ~ModelIndex();
+
+        ModelIndex(const ModelIndex&) = delete;
+        ModelIndex& operator=(const ModelIndex&) = delete;
+
+        void start();
+        void stop();
+
+        const std::string& getDirectory() const { return directory; }
+        uint64_t getVersion() const { return version.load(std::memory_order_acquire); }
+        bool isScanning() const { return scanning.load(std::memory_order_acquire); }
+
+        using Snapshot = std::shared_ptr<const std::vector<ModelFileInfo>>;
+
+        // daftar terurut berdasarkan nama file; immutable, disalin sekali per versi di thread worker
+        Snapshot snapshot() const;
+
+    private:
+        static constexpr int POLL_INTERVAL_MS = 2000;
+        // selama sniff header, versi baru paling cepat dipublish tiap interval ini
+        // (folder 100k file nggak perlu disalin ulang tiap file)
+        static constexpr int SNIFF_PUBLISH_INTERVAL_MS = 250;
+
+        std::string directory;
+        mutable std::mutex mutex;
+        std::vector<ModelFileInfo> files;
+        Snapshot published;
+        std::atomic<uint64_t> version{0};
+        std::atomic<bool> running{false};
+        std::atomic<bool> scanning{false};
+        std::thread worker;
+        int wakePipe[2] = {-1, -1};
+
+        void run();
+        void rescan();
+        void sniffPendingHeaders();
+        // dua-duanya belum publish; return true kalau daftar berubah
+        bool updateFile(const std::string& fileName);
+        bool removeFile(const std::string& fileName);
+        bool readFileInfo(const std::string& fileName, ModelFileInfo& info) const;
+        void sniffHeader(ModelFileInfo& info) const;
+        void waitForStop(int milliseconds);
+        void publishLocked();
+    };
+} // namespace graphics
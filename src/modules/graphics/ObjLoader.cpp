@@ -1,4 +1,6 @@
 #include "ObjLoader.hpp"
+#include "MappedFile.hpp"
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -83,6 +85,30 @@ namespace graphics {
         return mesh;
     }
 
+    template<typename T>
+    bool ObjLoader<T>::readHeaderCounts(const std::string& filePath, size_t& vertexCount, size_t& faceCount,
+                                        size_t maxScanBytes) {
+        MappedFile file(filePath);
+        if (!file.isOpen() || file.size() > maxScanBytes) {
+            return false;
+        }
+
+        vertexCount = 0;
+        faceCount = 0;
+        const char* cursor = reinterpret_cast<const char*>(file.data());
+        const char* end = cursor + file.size();
+        while (cursor < end) {
+            if (end - cursor >= 2 && cursor[1] == ' ') {
+                if (cursor[0] == 'v') vertexCount++;
+                else if (cursor[0] == 'f') faceCount++;
+            }
+            const char* newline = static_cast<const char*>(std::memchr(cursor, '\n', end - cursor));
+            if (!newline) break;
+            cursor = newline + 1;
+        }
+        return true;
+    }
+
     template class ObjLoader<float>;
     template class ObjLoader<double>;
 
@@ -7,5 +7,8 @@ namespace graphics {
     class ObjLoader {
     public:
         static Mesh<T> loadObj(const std::string& filePath);
+        // OBJ nggak punya header, jadi hitung baris "v"/"f" (file di atas maxScanBytes dilewati)
+        static bool readHeaderCounts(const std::string& filePath, size_t& vertexCount, size_t& faceCount,
+                                     size_t maxScanBytes = 64u * 1024u * 1024u);
     };
 } // namespace graphics
\ No newline at end of file
@@ -0,0 +1,363 @@
+#include "PlyLoader.hpp"
+#include "MappedFile.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace graphics {
+    namespace {
+        enum class PlyType { INT8, UINT8, INT16, UINT16, INT32, UINT32, FLOAT32, FLOAT64, INVALID };
+        enum class PlyFormat { ASCII, BINARY_LITTLE_ENDIAN, BINARY_BIG_ENDIAN };
+
+        struct PlyProperty {
+            std::string name;
+            PlyType type = PlyType::INVALID;
+            bool isList = false;
+            PlyType countType = PlyType::INVALID;
+        };
+
+        struct PlyElement {
+            std::string name;
+            size_t count = 0;
+            std::vector<PlyProperty> properties;
+        };
+
+        PlyType parseType(const std::string& name) {
+            if (name == "char" || name == "int8") return PlyType::INT8;
+            if (name == "uchar" || name == "uint8") return PlyType::UINT8;
+            if (name == "short" || name == "int16") return PlyType::INT16;
+            if (name == "ushort" || name == "uint16") return PlyType::UINT16;
+            if (name == "int" || name == "int32") return PlyType::INT32;
+            if (name == "uint" || name == "uint32") return PlyType::UINT32;
+            if (name == "float" || name == "float32") return PlyType::FLOAT32;
+            if (name == "double" || name == "float64") return PlyType::FLOAT64;
+            return PlyType::INVALID;
+        }
+
+        size_t typeSize(PlyType type) {
+            switch (type) {
+                case PlyType::INT8: case PlyType::UINT8: return 1;
+                case PlyType::INT16: case PlyType::UINT16: return 2;
+                case PlyType::INT32: case PlyType::UINT32: case PlyType::FLOAT32: return 4;
+                case PlyType::FLOAT64: return 8;
+                default: return 0;
+            }
+        }
+
+        double decodeScalar(const uint8_t* p, PlyType type, bool bigEndian) {
+            size_t n = typeSize(type);
+            uint64_t bits = 0;
+            for (size_t i = 0; i < n; ++i) {
+                size_t byteIndex = bigEndian ? (n - 1 - i) : i;
+                bits |= static_cast<uint64_t>(p[byteIndex]) << (8 * i);
+            }
+
+            switch (type) {
+                case PlyType::INT8: return static_cast<int8_t>(bits);
+                case PlyType::UINT8: return static_cast<uint8_t>(bits);
+                case PlyType::INT16: return static_cast<int16_t>(bits);
+                case PlyType::UINT16: return static_cast<uint16_t>(bits);
+                case PlyType::INT32: return static_cast<int32_t>(bits);
+                case PlyType::UINT32: return static_cast<uint32_t>(bits);
+                case PlyType::FLOAT32: {
+                    uint32_t bits32 = static_cast<uint32_t>(bits);
+                    float value;
+                    std::memcpy(&value, &bits32, sizeof(value));
+                    return value;
+                }
+                case PlyType::FLOAT64: {
+                    double value;
+                    std::memcpy(&value, &bits, sizeof(value));
+                    return value;
+                }
+                default: return 0.0;
+            }
+        }
+
+        // sumber nilai berurutan dari body, binary atau ascii
+        class PlyBodyReader {
+        public:
+            PlyBodyReader(const uint8_t* data, size_t size, PlyFormat format)
+                : cursor(data), end(data + size), format(format) {
+                if (format == PlyFormat::ASCII) {
+                    text.str(std::string(reinterpret_cast<const char*>(data), size));
+                }
+            }
+
+            double read(PlyType type) {
+                if (format == PlyFormat::ASCII) {
+                    double value;
+                    if (!(text >> value)) {
+                        throw std::runtime_error("[PlyLoader] data ascii terpotong.");
+                    }
+                    return value;
+                }
+                size_t n = typeSize(type);
+                if (static_cast<size_t>(end - cursor) < n) {
+                    throw std::runtime_error("[PlyLoader] data binary terpotong.");
+                }
+                double value = decodeScalar(cursor, type, format == PlyFormat::BINARY_BIG_ENDIAN);
+                cursor += n;
+                return value;
+            }
+
+            // buat element yang semua propertinya fixed-size: ambil satu record utuh sekaligus
+            const uint8_t* takeRecord(size_t stride) {
+                if (static_cast<size_t>(end - cursor) < stride) {
+                    throw std::runtime_error("[PlyLoader] data binary terpotong.");
+                }
+                const uint8_t* record = cursor;
+                cursor += stride;
+                return record;
+            }
+
+            void skip(const PlyProperty& property) {
+                if (property.isList) {
+                    size_t count = static_cast<size_t>(read(property.countType));
+                    for (size_t i = 0; i < count; ++i) read(property.type);
+                } else {
+                    read(property.type);
+                }
+            }
+
+            // byte body yang belum dibaca (ascii: seluruh body, cukup sebagai batas atas)
+            size_t remaining() const { return static_cast<size_t>(end - cursor); }
+
+            bool isBinary() const { return format != PlyFormat::ASCII; }
+            bool isBigEndian() const { return format == PlyFormat::BINARY_BIG_ENDIAN; }
+
+        private:
+            const uint8_t* cursor;
+            const uint8_t* end;
+            PlyFormat format;
+            std::istringstream text;
+        };
+
+        size_t fixedStride(const PlyElement& element) {
+            size_t stride = 0;
+            for (const auto& property : element.properties) {
+                if (property.isList) return 0;
+                stride += typeSize(property.type);
+            }
+            return stride;
+        }
+    }
+
+    template<typename T>
+    Mesh<T> PlyLoader<T>::loadPly(const std::string& filePath) {
+        Mesh<T> mesh;
+        MappedFile file(filePath);
+
+        if (!file.isOpen()) {
+            std::cerr << "Error: Tidak dapat membuka file " << filePath << std::endl;
+            return mesh;
+        }
+
+        const char* text = reinterpret_cast<const char*>(file.data());
+        size_t size = file.size();
+        if (size < 4 || std::memcmp(text, "ply", 3) != 0) {
+            std::cerr << "Error: Bukan file PLY " << filePath << std::endl;
+            return mesh;
+        }
+
+        // header selalu ascii, diakhiri baris "end_header"
+        std::string headerView(text, std::min(size, static_cast<size_t>(64 * 1024)));
+        size_t endHeader = headerView.find("end_header");
+        size_t bodyStart = endHeader == std::string::npos ? std::string::npos : headerView.find('\n', endHeader);
+        if (bodyStart == std::string::npos) {
+            std::cerr << "Error: Header PLY tidak lengkap " << filePath << std::endl;
+            return mesh;
+        }
+        bodyStart += 1;
+
+        PlyFormat format = PlyFormat::ASCII;
+        std::vector<PlyElement> elements;
+        std::istringstream header(headerView.substr(0, endHeader));
+        std::string line;
+        while (std::getline(header, line)) {
+            std::istringstream ss(line);
+            std::string keyword;
+            ss >> keyword;
+
+            if (keyword == "format") {
+                std::string formatName;
+                ss >> formatName;
+                if (formatName == "binary_little_endian") format = PlyFormat::BINARY_LITTLE_ENDIAN;
+                else if (formatName == "binary_big_endian") format = PlyFormat::BINARY_BIG_ENDIAN;
+                else format = PlyFormat::ASCII;
+            } else if (keyword == "element") {
+                PlyElement element;
+                ss >> element.name >> element.count;
+                elements.push_back(element);
+            } else if (keyword == "property" && !elements.empty()) {
+                PlyProperty property;
+                std::string typeName;
+                ss >> typeName;
+                if (typeName == "list") {
+                    std::string countTypeName, itemTypeName;
+                    ss >> countTypeName >> itemTypeName >> property.name;
+                    property.isList = true;
+                    property.countType = parseType(countTypeName);
+                    property.type = parseType(itemTypeName);
+                } else {
+                    property.type = parseType(typeName);
+                    ss >> property.name;
+                }
+                if (property.type == PlyType::INVALID || (property.isList && property.countType == PlyType::INVALID)) {
+                    std::cerr << "Error: Tipe properti PLY tidak dikenal di " << filePath << std::endl;
+                    return mesh;
+                }
+                elements.back().properties.push_back(property);
+            }
+        }
+
+        PlyBodyReader body(file.data() + bodyStart, size - bodyStart, format);
+        size_t invalidFaces = 0;
+
+        try {
+            for (const PlyElement& element : elements) {
+                size_t stride = body.isBinary() ? fixedStride(element) : 0;
+
+                if (element.name == "vertex") {
+                    int axisProperty[3] = {-1, -1, -1};
+                    size_t axisOffset[3] = {0, 0, 0};
+                    size_t offset = 0;
+                    for (size_t p = 0; p < element.properties.size(); ++p) {
+                        const std::string& name = element.properties[p].name;
+                        int axis = name == "x" ? 0 : name == "y" ? 1 : name == "z" ? 2 : -1;
+                        if (axis >= 0) {
+                            axisProperty[axis] = static_cast<int>(p);
+                            axisOffset[axis] = offset;
+                        }
+                        offset += typeSize(element.properties[p].type);
+                    }
+                    if (axisProperty[0] < 0 || axisProperty[1] < 0 || axisProperty[2] < 0) {
+                        throw std::runtime_error("[PlyLoader] element vertex tanpa properti x/y/z.");
+                    }
+
+                    // count dari header belum bisa dipercaya, jadi alokasinya dibatasi isi body yang benar-benar ada
+                    if (stride > 0) {
+                        if (element.count > body.remaining() / stride) {
+                            throw std::runtime_error("[PlyLoader] data binary terpotong.");
+                        }
+                        mesh.vertices.resize(element.count);
+                        // layout fixed: baca record langsung dari mmap dengan stride tetap
+                        PlyType types[3] = {
+                            element.properties[axisProperty[0]].type,
+                            element.properties[axisProperty[1]].type,
+                            element.properties[axisProperty[2]].type
+                        };
+                        for (size_t i = 0; i < element.count; ++i) {
+                            const uint8_t* record = body.takeRecord(stride);
+                            mesh.vertices[i] = math::Vector3<T>(
+                                static_cast<T>(decodeScalar(record + axisOffset[0], types[0], body.isBigEndian())),
+                                static_cast<T>(decodeScalar(record + axisOffset[1], types[1], body.isBigEndian())),
+                                static_cast<T>(decodeScalar(record + axisOffset[2], types[2], body.isBigEndian()))
+                            );
+                        }
+                    } else {
+                        // tiap vertex minimal 3 byte (tiga nilai x/y/z), jadi reserve nggak melebihi isi body
+                        mesh.vertices.reserve(std::min(element.count, body.remaining() / 3));
+                        for (size_t i = 0; i < element.count; ++i) {
+                            T coords[3] = {0, 0, 0};
+                            for (size_t p = 0; p < element.properties.size(); ++p) {
+                                const PlyProperty& property = element.properties[p];
+                                int axis = static_cast<int>(p) == axisProperty[0] ? 0 :
+                                           static_cast<int>(p) == axisProperty[1] ? 1 :
+                                           static_cast<int>(p) == axisProperty[2] ? 2 : -1;
+                                if (axis >= 0) {
+                                    coords[axis] = static_cast<T>(body.read(property.type));
+                                } else {
+                                    body.skip(property);
+                                }
+                            }
+                            mesh.vertices.emplace_back(coords[0], coords[1], coords[2]);
+                        }
+                    }
+                } else if (element.name == "face") {
+                    // tiap face minimal 4 byte (count + 3 index)
+                    mesh.faces.reserve(std::min(element.count, body.remaining() / 4));
+                    std::vector<int> face;
+                    for (size_t i = 0; i < element.count; ++i) {
+                        face.clear();
+                        bool valid = true;
+                        for (const PlyProperty& property : element.properties) {
+                            if (property.isList && (property.name == "vertex_indices" || property.name == "vertex_index")) {
+                                size_t count = static_cast<size_t>(body.read(property.countType));
+                                face.reserve(std::min(count, body.remaining()));
+                                for (size_t k = 0; k < count; ++k) {
+                                    int index = static_cast<int>(body.read(property.type));
+                                    if (index < 0 || index >= static_cast<int>(mesh.vertices.size())) {
+                                        valid = false;
+                                    }
+                                    face.push_back(index);
+                                }
+                            } else {
+                                body.skip(property);
+                            }
+                        }
+                        if (valid && face.size() >= 3) {
+                            mesh.faces.push_back(face);
+                        } else {
+                            invalidFaces++;
+                        }
+                    }
+                } else if (stride > 0) {
+                    for (size_t i = 0; i < element.count; ++i) body.takeRecord(stride);
+                } else {
+                    for (size_t i = 0; i < element.count; ++i) {
+                        for (const PlyProperty& property : element.properties) body.skip(property);
+                    }
+                }
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << " (" << filePath << ")" << std::endl;
+            return Mesh<T>();
+        }
+
+        if (invalidFaces > 0) {
+            std::cerr << "Warning: " << invalidFaces << " face invalid dibuang" << std::endl;
+        }
+
+        std::cout << "Behasil memuat file PLY: " << filePath << std::endl;
+        std::cout << "Vertices: " << mesh.vertices.size() << std::endl;
+        std::cout << "Faces: " << mesh.faces.size() << std::endl;
+
+        return mesh;
+    }
+
+    template<typename T>
+    bool PlyLoader<T>::readHeaderCounts(const std::string& filePath, size_t& vertexCount, size_t& faceCount) {
+        MappedFile file(filePath);
+        if (!file.isOpen() || file.size() < 4 || std::memcmp(file.data(), "ply", 3) != 0) {
+            return false;
+        }
+
+        std::string headerView(reinterpret_cast<const char*>(file.data()), std::min(file.size(), static_cast<size_t>(64 * 1024)));
+        size_t endHeader = headerView.find("end_header");
+        if (endHeader == std::string::npos) {
+            return false;
+        }
+
+        vertexCount = 0;
+        faceCount = 0;
+        std::istringstream header(headerView.substr(0, endHeader));
+        std::string line;
+        while (std::getline(header, line)) {
+            std::istringstream ss(line);
+            std::string keyword, name;
+            size_t count = 0;
+            if (ss >> keyword >> name >> count && keyword == "element") {
+                if (name == "vertex") vertexCount = count;
+                else if (name == "face") faceCount = count;
+            }
+        }
+        return true;
+    }
+
+    template class PlyLoader<float>;
+    template class PlyLoader<double>;
+
+} // namespace graphics
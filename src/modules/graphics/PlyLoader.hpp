@@ -0,0 +1,15 @@
+#pragma once
+#include <string>
+#include "Mesh.hpp"
+
+namespace graphics {
+    template<typename T>
+    class PlyLoader {
+    public:
+        // mendukung binary_little_endian, binary_big_endian, dan ascii.
+        // cuma properti x/y/z dari element "vertex" dan list "vertex_indices" dari element "face" yang dipakai
+        static Mesh<T> loadPly(const std::string& filePath);
+        // cuma baca header ("element vertex N", "element face N")
+        static bool readHeaderCounts(const std::string& filePath, size_t& vertexCount, size_t& faceCount);
+    };
+} // namespace graphics
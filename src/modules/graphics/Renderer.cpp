@@ -1,11 +1,15 @@
 #include "Renderer.hpp"
+#include "MeshQuantizer.hpp"
 #include <limits>
 #include <iostream>
+#include <algorithm>
+#include <vector>
 
 namespace graphics {
     template<typename T>
     Renderer<T>::Renderer(SDL_Renderer* renderer, int screenWidth, int screenHeight) :
-        renderer(renderer), screenWidth(screenWidth), screenHeight(screenHeight) {
+        renderer(renderer), screenWidth(screenWidth), screenHeight(screenHeight),
+        windowWidth(screenWidth), windowHeight(screenHeight) {
         
         labelFont = TTF_OpenFont("../assets/fonts/Miracode.ttf", 16);
         if (!labelFont) {
@@ -26,6 +30,13 @@ namespace graphics {
         SDL_RenderClear(renderer);
     }
 
+    template<typename T>
+    void Renderer<T>::setViewport(const SDL_Rect* viewport) {
+        SDL_RenderSetViewport(renderer, viewport);
+        screenWidth = viewport ? viewport->w : windowWidth;
+        screenHeight = viewport ? viewport->h : windowHeight;
+    }
+
     template<typename T>
     void Renderer<T>::present() {
         SDL_RenderPresent(renderer);
@@ -179,8 +190,92 @@ namespace graphics {
     }
 
     template<typename T>
-    void Renderer<T>::drawMesh(const graphics::Mesh<T>& mesh, const math::Matrix4<T>& modelMatrix, const math::Matrix4<T>& viewMatrix, const math::Matrix4<T>& projectionMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    void Renderer<T>::drawPolyline(const math::Vector3<T>* points, size_t count, const math::Matrix4<T>& mvpMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+        if (count < 2) return;
+
+        // tiap titik diproyeksi sekali (drawLine per segmen memproyeksi titik tengah dua kali);
+        // segmen yang utuh di layar digabung jadi satu SDL_RenderDrawLines
+        std::vector<math::Vector3<T>> projected(count);
+        for (size_t i = 0; i < count; ++i) {
+            projected[i] = project(points[i], mvpMatrix);
+        }
+
+        SDL_SetRenderDrawColor(renderer, r, g, b, a);
+        std::vector<SDL_Point> run;
+        run.reserve(count);
+        auto flush = [this, &run]() {
+            if (run.size() >= 2) {
+                SDL_RenderDrawLines(renderer, run.data(), static_cast<int>(run.size()));
+            }
+            run.clear();
+        };
+
+        for (size_t i = 0; i + 1 < count; ++i) {
+            math::Vector3<T> p1 = projected[i];
+            math::Vector3<T> p2 = projected[i + 1];
+            if (!clipLine(p1, p2)) {
+                flush();
+                continue;
+            }
+            SDL_Point start = {static_cast<int>(p1.x), static_cast<int>(p1.y)};
+            SDL_Point end = {static_cast<int>(p2.x), static_cast<int>(p2.y)};
+            if (run.empty() || run.back().x != start.x || run.back().y != start.y) {
+                flush();
+                run.push_back(start);
+            }
+            run.push_back(end);
+        }
+        flush();
+    }
+
+    // titik di belakang kamera, di luar near/far, atau di luar layar dibuang; out diisi rapat, return jumlahnya
+    template<typename T>
+    size_t Renderer<T>::projectPoints(const math::Vector3<T>* points, size_t count, const math::Matrix4<T>& mvpMatrix, SDL_Point* out) const {
+        constexpr size_t BLOCK_SIZE = 256;
+        math::Vector4<T> clip[BLOCK_SIZE];
+        const T halfWidth = static_cast<T>(0.5) * static_cast<T>(screenWidth);
+        const T halfHeight = static_cast<T>(0.5) * static_cast<T>(screenHeight);
+        size_t written = 0;
+        for (size_t begin = 0; begin < count; begin += BLOCK_SIZE) {
+            size_t blockCount = std::min(BLOCK_SIZE, count - begin);
+            for (size_t i = 0; i < blockCount; ++i) {
+                const math::Vector3<T>& p = points[begin + i];
+                clip[i] = math::Vector4<T>(p.x, p.y, p.z, static_cast<T>(1));
+            }
+            mvpMatrix.transformBatch(clip, clip, blockCount);
+            for (size_t i = 0; i < blockCount; ++i) {
+                T w = clip[i].w();
+                if (!(w > std::numeric_limits<T>::epsilon())) continue;
+                T inverseW = static_cast<T>(1) / w;
+                T z = clip[i].z() * inverseW;
+                if (z < static_cast<T>(-1) || z > static_cast<T>(1)) continue;
+                T screenX = (clip[i].x() * inverseW + static_cast<T>(1)) * halfWidth;
+                T screenY = (static_cast<T>(1) - clip[i].y() * inverseW) * halfHeight;
+                if (!(screenX >= 0 && screenX < screenWidth && screenY >= 0 && screenY < screenHeight)) continue;
+                out[written++] = {static_cast<int>(screenX), static_cast<int>(screenY)};
+            }
+        }
+        return written;
+    }
+
+    template<typename T>
+    void Renderer<T>::drawScreenPoints(const SDL_Point* points, size_t count, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+        if (count == 0) return;
+        SDL_SetRenderDrawColor(renderer, r, g, b, a);
+        SDL_RenderDrawPoints(renderer, points, static_cast<int>(count));
+    }
+
+    template<typename T>
+    void Renderer<T>::drawPoints(const math::Vector3<T>* points, size_t count, const math::Matrix4<T>& mvpMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+        std::vector<SDL_Point> projected(count);
+        drawScreenPoints(projected.data(), projectPoints(points, count, mvpMatrix, projected.data()), r, g, b, a);
+    }
+
+    template<typename T>
+    template<typename VertexFetch>
+    void Renderer<T>::drawFaces(const graphics::Mesh<T>& mesh, VertexFetch fetchVertex, const math::Matrix4<T>& modelMatrix, const math::Matrix4<T>& viewMatrix, const math::Matrix4<T>& projectionMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
         math::Matrix4<T> mvpMatrix = projectionMatrix * viewMatrix * modelMatrix;
+        const int vertexCount = static_cast<int>(mesh.vertexCount());
         std::vector<SDL_Point> points;
         points.reserve(mesh.faces.size() * 6);
         SDL_SetRenderDrawColor(renderer, r, g, b, a);
@@ -192,14 +287,14 @@ namespace graphics {
                 int idx1 = face[i];
                 int idx2 = face[(i + 1) % face.size()];
 
-                if (idx1 < 0 || idx1 >= static_cast<int>(mesh.vertices.size()) ||
-                    idx2 < 0 || idx2 >= static_cast<int>(mesh.vertices.size())) {
+                if (idx1 < 0 || idx1 >= vertexCount ||
+                    idx2 < 0 || idx2 >= vertexCount) {
                     std::cerr << "Index vertex invalid di face: " << idx1 << " atau " << idx2 << std::endl;
                     continue;
                 }
 
-                math::Vector3<T> p1 = mesh.vertices[idx1];
-                math::Vector3<T> p2 = mesh.vertices[idx2];
+                math::Vector3<T> p1 = fetchVertex(idx1);
+                math::Vector3<T> p2 = fetchVertex(idx2);
                 
                 
                 math::Vector3<T> clippedWorldP1, clippedWorldP2;
@@ -224,6 +319,130 @@ namespace graphics {
     SDL_RenderDrawLines(renderer, points.data(), points.size());
     }
 
+    template<typename T>
+    void Renderer<T>::drawMesh(const graphics::Mesh<T>& mesh, const math::Matrix4<T>& modelMatrix, const math::Matrix4<T>& viewMatrix, const math::Matrix4<T>& projectionMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+        if (mesh.isQuantized()) {
+            // dekuantisasi digabung ke model matrix, jadi vertex 16-bit langsung masuk transform
+            math::Matrix4<T> fusedModelMatrix = modelMatrix * MeshQuantizer<T>::dequantizationMatrix(mesh);
+            drawFaces(mesh, [&mesh](int index) {
+                const std::array<uint16_t, 3>& q = mesh.quantizedVertices[index];
+                return math::Vector3<T>(static_cast<T>(q[0]), static_cast<T>(q[1]), static_cast<T>(q[2]));
+            }, fusedModelMatrix, viewMatrix, projectionMatrix, r, g, b, a);
+        } else {
+            drawFaces(mesh, [&mesh](int index) {
+                return mesh.vertices[index];
+            }, modelMatrix, viewMatrix, projectionMatrix, r, g, b, a);
+        }
+    }
+
+    template<typename T>
+    math::Vector3<T> Renderer<T>::clipToScreen(const math::Vector4<T>& clip) const {
+        T inverseW = static_cast<T>(1) / clip.w();
+        return math::Vector3<T>((clip.x() * inverseW + static_cast<T>(1)) * static_cast<T>(0.5) * static_cast<T>(screenWidth),
+                                (static_cast<T>(1) - clip.y() * inverseW) * static_cast<T>(0.5) * static_cast<T>(screenHeight),
+                                clip.z() * inverseW);
+    }
+
+    template<typename T>
+    void Renderer<T>::drawWireframes(const graphics::Mesh<T>& mesh, const Wireframe<T>& wireframe, const math::Matrix4<T>* modelMatrices,
+                                     const SDL_Color* colors, size_t count, const math::Matrix4<T>& viewMatrix, const math::Matrix4<T>& projectionMatrix) {
+        if (wireframe.empty() || count == 0) return;
+        const size_t vertexCount = wireframe.vertexCount;
+        if (vertexCount != mesh.vertexCount()) {
+            std::cerr << "[Renderer] wireframe bukan dari mesh ini, dilewati." << std::endl;
+            return;
+        }
+
+        // near plane yang sama dengan clipToNearPlane (z view = -0.1), di clip space perspektif jadi w = 0.1
+        const T nearW = static_cast<T>(0.1);
+        // posisi dibaca per blok dari mesh, jadi buffer homogennya kecil & tetap; sisanya sebesar jumlah vertex
+        const size_t blockSize = 1024;
+        wireframeBlock.resize(std::min(blockSize, vertexCount));
+        wireframeClip.resize(vertexCount);
+        wireframeScreen.resize(vertexCount);
+        math::Matrix4<T> viewProjectionMatrix = projectionMatrix * viewMatrix;
+        // sama seperti drawMesh: vertex 16-bit langsung masuk transform, dekuantisasinya ikut di mvp
+        const math::Matrix4<T> dequantizationMatrix = MeshQuantizer<T>::dequantizationMatrix(mesh);
+
+        auto flush = [this]() {
+            if (wireframeRun.size() >= 2) {
+                SDL_RenderDrawLines(renderer, wireframeRun.data(), static_cast<int>(wireframeRun.size()));
+            }
+            wireframeRun.clear();
+        };
+
+        for (size_t pose = 0; pose < count; ++pose) {
+            math::Matrix4<T> mvpMatrix = viewProjectionMatrix * modelMatrices[pose];
+
+            // w linear terhadap posisi model (baris terakhir mvp), jadi rentangnya di bounding sphere = pusat ± r |a|
+            T ax = mvpMatrix(3, 0), ay = mvpMatrix(3, 1), az = mvpMatrix(3, 2);
+            const math::Vector3<T>& center = wireframe.boundsCenter;
+            T centerW = ax * center.x + ay * center.y + az * center.z + mvpMatrix(3, 3);
+            T spreadW = wireframe.boundsRadius * std::sqrt(ax * ax + ay * ay + az * az);
+            if (centerW + spreadW < nearW) continue; // seluruhnya di belakang kamera
+            bool needsNearClip = centerW - spreadW < nearW;
+
+            math::Matrix4<T> vertexMatrix = mvpMatrix * dequantizationMatrix;
+            for (size_t first = 0; first < vertexCount; first += blockSize) {
+                const size_t blockCount = std::min(blockSize, vertexCount - first);
+                if (mesh.isQuantized()) {
+                    for (size_t i = 0; i < blockCount; ++i) {
+                        const std::array<uint16_t, 3>& q = mesh.quantizedVertices[first + i];
+                        wireframeBlock[i] = math::Vector4<T>(static_cast<T>(q[0]), static_cast<T>(q[1]), static_cast<T>(q[2]), static_cast<T>(1));
+                    }
+                } else {
+                    for (size_t i = 0; i < blockCount; ++i) {
+                        wireframeBlock[i] = math::Vector4<T>(mesh.vertices[first + i], static_cast<T>(1));
+                    }
+                }
+                vertexMatrix.transformBatch(wireframeBlock.data(), wireframeClip.data() + first, blockCount);
+            }
+            for (size_t i = 0; i < vertexCount; ++i) {
+                if (wireframeClip[i].w() >= nearW) {
+                    wireframeScreen[i] = clipToScreen(wireframeClip[i]);
+                }
+            }
+
+            SDL_SetRenderDrawColor(renderer, colors[pose].r, colors[pose].g, colors[pose].b, colors[pose].a);
+            for (size_t strip = 0; strip < wireframe.stripCount(); ++strip) {
+                for (size_t i = wireframe.stripOffsets[strip]; i + 1 < wireframe.stripOffsets[strip + 1]; ++i) {
+                    int a = wireframe.stripIndices[i];
+                    int b = wireframe.stripIndices[i + 1];
+                    math::Vector3<T> p1 = wireframeScreen[a];
+                    math::Vector3<T> p2 = wireframeScreen[b];
+                    if (needsNearClip) {
+                        const math::Vector4<T>& c1 = wireframeClip[a];
+                        const math::Vector4<T>& c2 = wireframeClip[b];
+                        bool p1Behind = c1.w() < nearW;
+                        bool p2Behind = c2.w() < nearW;
+                        if (p1Behind && p2Behind) {
+                            flush();
+                            continue;
+                        }
+                        if (p1Behind || p2Behind) {
+                            T t = (nearW - c1.w()) / (c2.w() - c1.w());
+                            math::Vector4<T> intersection(c1.x() + t * (c2.x() - c1.x()), c1.y() + t * (c2.y() - c1.y()),
+                                                          c1.z() + t * (c2.z() - c1.z()), nearW);
+                            (p1Behind ? p1 : p2) = clipToScreen(intersection);
+                        }
+                    }
+                    if (!clipLine(p1, p2)) {
+                        flush();
+                        continue;
+                    }
+                    SDL_Point start = {static_cast<int>(p1.x), static_cast<int>(p1.y)};
+                    SDL_Point end = {static_cast<int>(p2.x), static_cast<int>(p2.y)};
+                    if (wireframeRun.empty() || wireframeRun.back().x != start.x || wireframeRun.back().y != start.y) {
+                        flush();
+                        wireframeRun.push_back(start);
+                    }
+                    wireframeRun.push_back(end);
+                }
+                flush();
+            }
+        }
+    }
+
     template<typename T>
     void Renderer<T>::drawAxes(const math::Matrix4<T>& viewProjectionMatrix) {
         
@@ -264,7 +483,7 @@ namespace graphics {
         math::Vector3<T> direction = (end - start);
         T length = std::sqrt(direction.x*direction.x + direction.y*direction.y + direction.z*direction.z);
         if (length > 0.001f) {
-            direction.x /= length; direction.y /= length; direction.z /= length;
+            direction = math::divideUnchecked(direction, length);
             
             T arrowSize = length * static_cast<T>(0.1); 
             
@@ -280,8 +499,8 @@ namespace graphics {
             
             T len1 = std::sqrt(perpendicular1.x*perpendicular1.x + perpendicular1.y*perpendicular1.y + perpendicular1.z*perpendicular1.z);
             T len2 = std::sqrt(perpendicular2.x*perpendicular2.x + perpendicular2.y*perpendicular2.y + perpendicular2.z*perpendicular2.z);
-            if (len1 > 0.001f) { perpendicular1.x /= len1; perpendicular1.y /= len1; perpendicular1.z /= len1; }
-            if (len2 > 0.001f) { perpendicular2.x /= len2; perpendicular2.y /= len2; perpendicular2.z /= len2; }
+            if (len1 > 0.001f) { perpendicular1 = math::divideUnchecked(perpendicular1, len1); }
+            if (len2 > 0.001f) { perpendicular2 = math::divideUnchecked(perpendicular2, len2); }
             
             
             math::Vector3<T> headBase = end - direction * arrowSize;
@@ -317,7 +536,14 @@ namespace graphics {
         if (!isValidScreenPoint(screenPos)) {
             return; 
         }
-        
+
+        drawText(text, static_cast<int>(screenPos.x) + 5, static_cast<int>(screenPos.y) - 10, r, g, b, a);
+    }
+
+    template<typename T>
+    void Renderer<T>::drawText(const std::string& text, int x, int y, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+        if (!labelFont) return;
+
         SDL_Color color = {r, g, b, a};
         SDL_Surface* surface = TTF_RenderText_Solid(labelFont, text.c_str(), color);
         if (!surface) {
@@ -332,19 +558,10 @@ namespace graphics {
             return;
         }
         
-        
-        SDL_Rect destRect = {
-            static_cast<int>(screenPos.x) + 5,  
-            static_cast<int>(screenPos.y) - 10, 
-            surface->w, 
-            surface->h
-        };
-        
+        SDL_Rect destRect = {x, y, surface->w, surface->h};
         SDL_RenderCopy(renderer, texture, nullptr, &destRect);
         SDL_DestroyTexture(texture);
         SDL_FreeSurface(surface);
-        
-
     }
 
     template class Renderer<float>;
@@ -5,6 +5,8 @@
 #include "../math/Vector2.hpp"
 #include "../math/Vector3.hpp"
 #include "../graphics/Mesh.hpp"
+#include "../graphics/Wireframe.hpp"
+#include <vector>
 
 namespace graphics {
     template<typename T>
@@ -15,9 +17,23 @@ namespace graphics {
 
         void clearScreen(Uint8 r, Uint8 g, Uint8 b, Uint8 a);
         void present();
+        // gambar berikutnya masuk ke viewport ini (koordinat jendela), ukuran layar buat proyeksi & clipping ikut
+        // viewport-nya; nullptr = seluruh jendela lagi
+        void setViewport(const SDL_Rect* viewport);
         math::Vector3<T> project(const math::Vector3<T>& worldPoint, const math::Matrix4<T>& mvpMatrix) const;
         void drawLine(const math::Vector3<T>& p1, const math::Vector3<T>& p2, const math::Matrix4<T>& mvpMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+        void drawPolyline(const math::Vector3<T>* points, size_t count, const math::Matrix4<T>& mvpMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+        // point cloud besar: projectPoints cuma membaca state renderer jadi boleh dipanggil paralel per potongan,
+        // lalu hasilnya dikirim per batch lewat drawScreenPoints. drawPoints = dua-duanya dalam satu thread
+        size_t projectPoints(const math::Vector3<T>* points, size_t count, const math::Matrix4<T>& mvpMatrix, SDL_Point* out) const;
+        void drawScreenPoints(const SDL_Point* points, size_t count, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+        void drawPoints(const math::Vector3<T>* points, size_t count, const math::Matrix4<T>& mvpMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
         void drawMesh(const graphics::Mesh<T>& mesh, const math::Matrix4<T>& modelMatrix, const math::Matrix4<T>& viewMatrix, const math::Matrix4<T>& projectionMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+        // satu wireframe di banyak pose (ghost onion-skin): per pose cuma satu mvp + transformBatch semua vertex,
+        // lalu strip dikirim per run yang bersambung. wireframe harus hasil Wireframe::build(mesh) dari mesh yang sama;
+        // colors[i] = warna pose ke-i
+        void drawWireframes(const graphics::Mesh<T>& mesh, const Wireframe<T>& wireframe, const math::Matrix4<T>* modelMatrices,
+                            const SDL_Color* colors, size_t count, const math::Matrix4<T>& viewMatrix, const math::Matrix4<T>& projectionMatrix);
         void drawAxes(const math::Matrix4<T>& viewProjectionMatrix);
 
         void drawAxesWithLabels(const math::Matrix4<T>& viewProjectionMatrix);
@@ -25,6 +41,8 @@ namespace graphics {
                     const math::Matrix4<T>& mvpMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
         void drawText3D(const std::string& text, const math::Vector3<T>& worldPos, 
                         const math::Matrix4<T>& mvpMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+        // teks di koordinat layar (relatif ke viewport aktif)
+        void drawText(const std::string& text, int x, int y, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
 
     private:
         bool isValidScreenPoint(const math::Vector3<T>& screenPoint) const;
@@ -33,10 +51,21 @@ namespace graphics {
         bool clipToNearPlane(const math::Vector3<T>& worldP1, const math::Vector3<T>& worldP2, 
                         const math::Matrix4<T>& viewMatrix, const math::Matrix4<T>& modelMatrix,
                         math::Vector3<T>& clippedP1, math::Vector3<T>& clippedP2) const;
+        math::Vector3<T> clipToScreen(const math::Vector4<T>& clip) const;
+        template<typename VertexFetch>
+        void drawFaces(const graphics::Mesh<T>& mesh, VertexFetch fetchVertex, const math::Matrix4<T>& modelMatrix, const math::Matrix4<T>& viewMatrix, const math::Matrix4<T>& projectionMatrix, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
         
         SDL_Renderer* renderer;
         int screenWidth;
         int screenHeight;
+        int windowWidth;
+        int windowHeight;
         TTF_Font* labelFont;
+
+        // buffer kerja drawWireframes, dipakai ulang antar pose & frame
+        std::vector<math::Vector4<T>> wireframeBlock; // posisi homogen satu blok vertex mesh sebelum transformBatch
+        std::vector<math::Vector4<T>> wireframeClip;
+        std::vector<math::Vector3<T>> wireframeScreen;
+        std::vector<SDL_Point> wireframeRun;
     };
 } // namespace graphics
\ No newline at end of file
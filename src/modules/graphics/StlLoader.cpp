@@ -0,0 +1,120 @@
+#include "StlLoader.hpp"
+#include "MappedFile.hpp"
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+namespace graphics {
+    namespace {
+        const size_t STL_HEADER_SIZE = 80;
+        const size_t STL_TRIANGLE_SIZE = 50; // normal (12) + 3 vertex (36) + attribute (2)
+
+        uint32_t readUint32LE(const uint8_t* p) {
+            return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+                   (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+        }
+
+        float readFloatLE(const uint8_t* p) {
+            uint32_t bits = readUint32LE(p);
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        template<typename T>
+        void parseAsciiStl(const uint8_t* data, size_t size, Mesh<T>& mesh) {
+            std::istringstream stream(std::string(reinterpret_cast<const char*>(data), size));
+            std::string token;
+            std::vector<int> face;
+
+            while (stream >> token) {
+                if (token == "vertex") {
+                    T x, y, z;
+                    if (stream >> x >> y >> z) {
+                        face.push_back(static_cast<int>(mesh.vertices.size()));
+                        mesh.vertices.emplace_back(x, y, z);
+                    }
+                } else if (token == "endloop") {
+                    if (face.size() >= 3) {
+                        mesh.faces.push_back(face);
+                    }
+                    face.clear();
+                }
+            }
+        }
+    }
+
+    template<typename T>
+    Mesh<T> StlLoader<T>::loadStl(const std::string& filePath) {
+        Mesh<T> mesh;
+        MappedFile file(filePath);
+
+        if (!file.isOpen()) {
+            std::cerr << "Error: Tidak dapat membuka file " << filePath << std::endl;
+            return mesh;
+        }
+
+        const uint8_t* data = file.data();
+        size_t size = file.size();
+
+        // STL binary ukurannya pasti 84 + 50 * jumlah segitiga; header binary kadang juga diawali "solid"
+        bool isBinary = false;
+        uint32_t triangleCount = 0;
+        if (size >= STL_HEADER_SIZE + 4) {
+            triangleCount = readUint32LE(data + STL_HEADER_SIZE);
+            isBinary = STL_HEADER_SIZE + 4 + static_cast<size_t>(triangleCount) * STL_TRIANGLE_SIZE == size;
+        }
+
+        if (isBinary) {
+            mesh.vertices.resize(static_cast<size_t>(triangleCount) * 3);
+            mesh.faces.resize(triangleCount);
+
+            const uint8_t* record = data + STL_HEADER_SIZE + 4;
+            for (uint32_t t = 0; t < triangleCount; ++t, record += STL_TRIANGLE_SIZE) {
+                const uint8_t* vertexData = record + 12;
+                std::vector<int>& face = mesh.faces[t];
+                face.resize(3);
+                for (int k = 0; k < 3; ++k, vertexData += 12) {
+                    int index = static_cast<int>(t * 3 + k);
+                    mesh.vertices[index] = math::Vector3<T>(
+                        static_cast<T>(readFloatLE(vertexData)),
+                        static_cast<T>(readFloatLE(vertexData + 4)),
+                        static_cast<T>(readFloatLE(vertexData + 8))
+                    );
+                    face[k] = index;
+                }
+            }
+        } else if (size >= 5 && std::memcmp(data, "solid", 5) == 0) {
+            parseAsciiStl(data, size, mesh);
+        } else {
+            std::cerr << "Error: Format STL tidak valid " << filePath << std::endl;
+            return mesh;
+        }
+
+        std::cout << "Behasil memuat file STL: " << filePath << std::endl;
+        std::cout << "Vertices: " << mesh.vertices.size() << std::endl;
+        std::cout << "Faces: " << mesh.faces.size() << std::endl;
+
+        return mesh;
+    }
+
+    template<typename T>
+    bool StlLoader<T>::readHeaderCounts(const std::string& filePath, size_t& vertexCount, size_t& faceCount) {
+        MappedFile file(filePath);
+        if (!file.isOpen() || file.size() < STL_HEADER_SIZE + 4) {
+            return false;
+        }
+
+        uint32_t triangleCount = readUint32LE(file.data() + STL_HEADER_SIZE);
+        if (STL_HEADER_SIZE + 4 + static_cast<size_t>(triangleCount) * STL_TRIANGLE_SIZE != file.size()) {
+            return false;
+        }
+        vertexCount = static_cast<size_t>(triangleCount) * 3;
+        faceCount = triangleCount;
+        return true;
+    }
+
+    template class StlLoader<float>;
+    template class StlLoader<double>;
+
+} // namespace graphics
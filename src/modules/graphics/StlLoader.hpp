@@ -0,0 +1,15 @@
+#pragma once
+#include <string>
+#include "Mesh.hpp"
+
+namespace graphics {
+    template<typename T>
+    class StlLoader {
+    public:
+        // binary STL dibaca langsung dari file yang di-mmap; STL ASCII juga diterima.
+        // STL nyimpen 3 vertex per segitiga, jadi sebaiknya di-weld setelahnya
+        static Mesh<T> loadStl(const std::string& filePath);
+        // cuma baca header; jumlah vertex = 3 * segitiga (sebelum weld). STL ASCII tidak diketahui
+        static bool readHeaderCounts(const std::string& filePath, size_t& vertexCount, size_t& faceCount);
+    };
+} // namespace graphics
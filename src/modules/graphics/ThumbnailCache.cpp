@@ -0,0 +1,155 @@
+#include "ThumbnailCache.hpp"
+#include "MeshLoader.hpp"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace graphics {
+    namespace {
+        const char MAGIC[4] = {'Q', 'T', 'H', 'B'};
+
+        uint64_t fnv1a(const void* data, size_t size, uint64_t hash = 14695981039346656037ULL) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; ++i) {
+                hash ^= bytes[i];
+                hash *= 1099511628211ULL;
+            }
+            return hash;
+        }
+
+        void writeUint32LE(std::ostream& out, uint32_t value) {
+            uint8_t bytes[4] = {static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8),
+                                static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 24)};
+            out.write(reinterpret_cast<const char*>(bytes), 4);
+        }
+
+        bool readUint32LE(std::istream& in, uint32_t& value) {
+            uint8_t bytes[4];
+            if (!in.read(reinterpret_cast<char*>(bytes), 4)) return false;
+            value = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+                    (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+            return true;
+        }
+    }
+
+    ThumbnailCache::ThumbnailCache(const std::string& cacheDirectory, int thumbnailSize, size_t workerCount)
+        : cacheDirectory(cacheDirectory), thumbnailSize(thumbnailSize),
+          pool(std::make_unique<app::ThreadPool>(workerCount)) {
+        std::error_code error;
+        std::filesystem::create_directories(cacheDirectory, error);
+        if (error) {
+            std::cerr << "[ThumbnailCache] Tidak bisa membuat folder cache " << cacheDirectory
+                      << ", thumbnail cuma disimpan di memori." << std::endl;
+        }
+    }
+
+    ThumbnailCache::~ThumbnailCache() {
+        // worker harus berhenti dulu sebelum entries/mutex ikut dihancurkan
+        pool.reset();
+    }
+
+    ThumbnailCache::ThumbnailHandle ThumbnailCache::request(const std::string& filePath, int64_t modifiedTime) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto found = entries.find(filePath);
+            if (found != entries.end() && found->second.modifiedTime == modifiedTime) {
+                return found->second.ready ? found->second.thumbnail : nullptr;
+            }
+            // belum pernah diminta, atau file-nya berubah sejak thumbnail lama dibuat
+            Entry& entry = entries[filePath];
+            entry.modifiedTime = modifiedTime;
+            entry.ready = false;
+            entry.thumbnail.reset();
+        }
+
+        pool->submit([this, filePath, modifiedTime]() { generate(filePath, modifiedTime); });
+        return nullptr;
+    }
+
+    void ThumbnailCache::generate(const std::string& filePath, int64_t modifiedTime) {
+        std::string cachePath = diskPath(filePath, modifiedTime);
+        auto thumbnail = std::make_shared<Thumbnail>();
+
+        if (!loadFromDisk(cachePath, *thumbnail)) {
+            try {
+                Mesh<float> mesh = MeshLoader<float>::loadFromFile(filePath);
+                if (!mesh.empty()) {
+                    *thumbnail = ThumbnailRenderer<float>::render(mesh, thumbnailSize);
+                    saveToDisk(cachePath, *thumbnail);
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "[ThumbnailCache] " << filePath << ": " << e.what() << std::endl;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto found = entries.find(filePath);
+            // hasil dibuang kalau selama render file-nya sudah diminta ulang dengan mtime lain
+            if (found == entries.end() || found->second.modifiedTime != modifiedTime) {
+                return;
+            }
+            found->second.thumbnail = thumbnail;
+            found->second.ready = true;
+        }
+        version.fetch_add(1, std::memory_order_release);
+    }
+
+    std::string ThumbnailCache::diskPath(const std::string& filePath, int64_t modifiedTime) const {
+        std::string absolute = filePath;
+        std::error_code error;
+        auto resolved = std::filesystem::absolute(filePath, error);
+        if (!error) absolute = resolved.string();
+
+        uint64_t hash = fnv1a(absolute.data(), absolute.size());
+        hash = fnv1a(&modifiedTime, sizeof(modifiedTime), hash);
+        hash = fnv1a(&thumbnailSize, sizeof(thumbnailSize), hash);
+
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.thumb", static_cast<unsigned long long>(hash));
+        return (std::filesystem::path(cacheDirectory) / name).string();
+    }
+
+    bool ThumbnailCache::loadFromDisk(const std::string& cachePath, Thumbnail& thumbnail) const {
+        std::ifstream file(cachePath, std::ios::binary);
+        char magic[4];
+        uint32_t width, height;
+        if (!file.read(magic, 4) || std::memcmp(magic, MAGIC, 4) != 0 ||
+            !readUint32LE(file, width) || !readUint32LE(file, height) ||
+            width != static_cast<uint32_t>(thumbnailSize) || height != static_cast<uint32_t>(thumbnailSize)) {
+            return false;
+        }
+
+        std::vector<uint32_t> pixels(static_cast<size_t>(width) * height);
+        for (auto& pixel : pixels) {
+            if (!readUint32LE(file, pixel)) return false;
+        }
+        thumbnail.width = static_cast<int>(width);
+        thumbnail.height = static_cast<int>(height);
+        thumbnail.pixels = std::move(pixels);
+        return true;
+    }
+
+    bool ThumbnailCache::saveToDisk(const std::string& cachePath, const Thumbnail& thumbnail) const {
+        // tulis ke file sementara lalu rename, jadi proses lain nggak pernah baca file setengah jadi
+        std::string tempPath = cachePath + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary);
+            if (!file) return false;
+            file.write(MAGIC, 4);
+            writeUint32LE(file, static_cast<uint32_t>(thumbnail.width));
+            writeUint32LE(file, static_cast<uint32_t>(thumbnail.height));
+            for (uint32_t pixel : thumbnail.pixels) {
+                writeUint32LE(file, pixel);
+            }
+            if (!file) return false;
+        }
+
+        std::error_code error;
+        std::filesystem::rename(tempPath, cachePath, error);
+        return !error;
+    }
+
+} // namespace graphics
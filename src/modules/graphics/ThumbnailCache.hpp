@@ -0,0 +1,52 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "ThumbnailRenderer.hpp"
+#include "../core/ThreadPool.hpp"
+
+namespace graphics {
+    // Thumbnail wireframe yang dibikin di worker pool.
+    // Urutan: memori -> file cache di disk (key = path + mtime) -> load mesh & render ulang.
+    // request() nggak pernah nge-block; selama belum siap hasilnya nullptr
+    class ThumbnailCache {
+    public:
+        using ThumbnailHandle = std::shared_ptr<const Thumbnail>;
+
+        ThumbnailCache(const std::string& cacheDirectory = ".thumbnails", int thumbnailSize = 36,
+                       size_t workerCount = app::ThreadPool::defaultWorkerCount());
+        ~ThumbnailCache();
+
+        ThumbnailCache(const ThumbnailCache&) = delete;
+        ThumbnailCache& operator=(const ThumbnailCache&) = delete;
+
+        // thumbnail kosong (empty()) berarti file-nya gagal di-load, nggak bakal dicoba lagi sampai mtime berubah
+        ThumbnailHandle request(const std::string& filePath, int64_t modifiedTime);
+
+        int getThumbnailSize() const { return thumbnailSize; }
+        // naik tiap ada thumbnail yang selesai
+        uint64_t getVersion() const { return version.load(std::memory_order_acquire); }
+
+    private:
+        struct Entry {
+            int64_t modifiedTime = 0;
+            bool ready = false;
+            ThumbnailHandle thumbnail;
+        };
+
+        std::string cacheDirectory;
+        int thumbnailSize;
+        std::mutex mutex;
+        std::unordered_map<std::string, Entry> entries;
+        std::atomic<uint64_t> version{0};
+        std::unique_ptr<app::ThreadPool> pool;
+
+        void generate(const std::string& filePath, int64_t modifiedTime);
+        std::string diskPath(const std::string& filePath, int64_t modifiedTime) const;
+        bool loadFromDisk(const std::string& cachePath, Thumbnail& thumbnail) const;
+        bool saveToDisk(const std::string& cachePath, const Thumbnail& thumbnail) const;
+    };
+} // namespace graphics
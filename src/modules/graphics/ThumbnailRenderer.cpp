@@ -0,0 +1,120 @@
+#include "ThumbnailRenderer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace graphics {
+    namespace {
+        struct ProjectedPoint {
+            int x, y;
+            float depth; // 0 = paling jauh, 1 = paling dekat
+        };
+
+        uint32_t blendColor(uint32_t background, uint32_t line, float intensity) {
+            uint32_t result = 0xFF000000;
+            for (int shift = 0; shift < 24; shift += 8) {
+                float b = static_cast<float>((background >> shift) & 0xFF);
+                float l = static_cast<float>((line >> shift) & 0xFF);
+                result |= static_cast<uint32_t>(b + (l - b) * intensity + 0.5f) << shift;
+            }
+            return result;
+        }
+
+        // Bresenham; tiap pixel simpan intensitas tertinggi supaya edge depan nggak ketimpa edge belakang
+        void drawLine(std::vector<float>& intensity, int size, const ProjectedPoint& a, const ProjectedPoint& b) {
+            int x0 = a.x, y0 = a.y;
+            int dx = std::abs(b.x - a.x), sx = a.x < b.x ? 1 : -1;
+            int dy = -std::abs(b.y - a.y), sy = a.y < b.y ? 1 : -1;
+            int error = dx + dy;
+            float value = 0.35f + 0.65f * 0.5f * (a.depth + b.depth);
+
+            while (true) {
+                if (x0 >= 0 && x0 < size && y0 >= 0 && y0 < size) {
+                    float& pixel = intensity[static_cast<size_t>(y0) * size + x0];
+                    pixel = std::max(pixel, value);
+                }
+                if (x0 == b.x && y0 == b.y) break;
+                int e2 = 2 * error;
+                if (e2 >= dy) { error += dy; x0 += sx; }
+                if (e2 <= dx) { error += dx; y0 += sy; }
+            }
+        }
+    }
+
+    template<typename T>
+    Thumbnail ThumbnailRenderer<T>::render(const Mesh<T>& mesh, int size, uint32_t background, uint32_t lineColor) {
+        Thumbnail thumbnail;
+        if (size <= 0) {
+            return thumbnail;
+        }
+        thumbnail.width = size;
+        thumbnail.height = size;
+        thumbnail.pixels.assign(static_cast<size_t>(size) * size, background);
+
+        size_t vertexCount = mesh.vertexCount();
+        if (vertexCount == 0) {
+            return thumbnail;
+        }
+
+        math::Vector3<T> minBound = mesh.getVertex(0);
+        math::Vector3<T> maxBound = minBound;
+        for (size_t i = 1; i < vertexCount; ++i) {
+            math::Vector3<T> v = mesh.getVertex(i);
+            minBound.x = std::min(minBound.x, v.x);
+            minBound.y = std::min(minBound.y, v.y);
+            minBound.z = std::min(minBound.z, v.z);
+            maxBound.x = std::max(maxBound.x, v.x);
+            maxBound.y = std::max(maxBound.y, v.y);
+            maxBound.z = std::max(maxBound.z, v.z);
+        }
+        math::Vector3<T> center = (minBound + maxBound) * static_cast<T>(0.5);
+        T radius = (maxBound - minBound).length() * static_cast<T>(0.5);
+        if (radius <= static_cast<T>(0)) {
+            radius = static_cast<T>(1);
+        }
+
+        // rotasi kamera: yaw 35 derajat lalu pitch 25 derajat
+        const T yaw = static_cast<T>(0.610865);
+        const T pitch = static_cast<T>(0.436332);
+        T cy = std::cos(yaw), sy = std::sin(yaw);
+        T cp = std::cos(pitch), sp = std::sin(pitch);
+
+        T scale = static_cast<T>(size) * static_cast<T>(0.48) / radius;
+        T half = static_cast<T>(size) * static_cast<T>(0.5);
+
+        std::vector<ProjectedPoint> projected(vertexCount);
+        for (size_t i = 0; i < vertexCount; ++i) {
+            math::Vector3<T> p = mesh.getVertex(i) - center;
+            T x = cy * p.x + sy * p.z;
+            T z1 = -sy * p.x + cy * p.z;
+            T y = cp * p.y - sp * z1;
+            T z = sp * p.y + cp * z1;
+
+            projected[i].x = static_cast<int>(std::lround(half + x * scale));
+            projected[i].y = static_cast<int>(std::lround(half - y * scale));
+            projected[i].depth = static_cast<float>(std::clamp((z / radius + static_cast<T>(1)) * static_cast<T>(0.5),
+                                                               static_cast<T>(0), static_cast<T>(1)));
+        }
+
+        std::vector<float> intensity(thumbnail.pixels.size(), 0.0f);
+        for (const auto& face : mesh.faces) {
+            for (size_t i = 0; i < face.size(); ++i) {
+                int a = face[i];
+                int b = face[(i + 1) % face.size()];
+                if (a < 0 || b < 0 || static_cast<size_t>(a) >= vertexCount || static_cast<size_t>(b) >= vertexCount) continue;
+                drawLine(intensity, size, projected[a], projected[b]);
+            }
+        }
+
+        for (size_t i = 0; i < intensity.size(); ++i) {
+            if (intensity[i] > 0.0f) {
+                thumbnail.pixels[i] = blendColor(background, lineColor, intensity[i]);
+            }
+        }
+        return thumbnail;
+    }
+
+    template class ThumbnailRenderer<float>;
+    template class ThumbnailRenderer<double>;
+
+} // namespace graphics
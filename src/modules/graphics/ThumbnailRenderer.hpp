@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Mesh.hpp"
+
+namespace graphics {
+    // gambar ARGB8888, baris demi baris (pitch = width * 4)
+    struct Thumbnail {
+        int width = 0;
+        int height = 0;
+        std::vector<uint32_t> pixels;
+
+        bool empty() const {
+            return pixels.empty();
+        }
+    };
+
+    // rasterizer wireframe di CPU buat preview kecil; nggak nyentuh SDL jadi aman dipanggil dari thread mana pun
+    template<typename T>
+    class ThumbnailRenderer {
+    public:
+        static constexpr uint32_t DEFAULT_BACKGROUND = 0xFF323232;
+        static constexpr uint32_t DEFAULT_LINE_COLOR = 0xFF4FB0FF;
+
+        // mesh dipusatkan & di-scale sesuai bounding sphere, dilihat dari sudut 3/4 (proyeksi ortografis).
+        // edge yang lebih dekat ke kamera digambar lebih terang
+        static Thumbnail render(const Mesh<T>& mesh, int size,
+                                uint32_t background = DEFAULT_BACKGROUND,
+                                uint32_t lineColor = DEFAULT_LINE_COLOR);
+    };
+} // namespace graphics
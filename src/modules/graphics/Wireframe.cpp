@@ -0,0 +1,119 @@
+#include "Wireframe.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace graphics {
+    namespace {
+        // edge tak berarah (a < b) dipak jadi satu key supaya bisa di-sort + unique
+        uint64_t packEdge(uint32_t a, uint32_t b) {
+            return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+        }
+    }
+
+    template<typename T>
+    Wireframe<T> Wireframe<T>::build(const Mesh<T>& mesh) {
+        Wireframe<T> wireframe;
+        const size_t vertexCount = mesh.vertexCount();
+        if (vertexCount == 0) {
+            return wireframe;
+        }
+
+        wireframe.vertexCount = vertexCount;
+        math::Vector3<T> minimum = mesh.getVertex(0);
+        math::Vector3<T> maximum = minimum;
+        for (size_t i = 0; i < vertexCount; ++i) {
+            math::Vector3<T> v = mesh.getVertex(i);
+            minimum = math::Vector3<T>(std::min(minimum.x, v.x), std::min(minimum.y, v.y), std::min(minimum.z, v.z));
+            maximum = math::Vector3<T>(std::max(maximum.x, v.x), std::max(maximum.y, v.y), std::max(maximum.z, v.z));
+        }
+        // bola di tengah AABB; nggak minimal, tapi cukup buat tes near plane
+        wireframe.boundsCenter = math::Vector3<T>((minimum.x + maximum.x) / static_cast<T>(2),
+                                                  (minimum.y + maximum.y) / static_cast<T>(2),
+                                                  (minimum.z + maximum.z) / static_cast<T>(2));
+        T radiusSquared = static_cast<T>(0);
+        for (size_t i = 0; i < vertexCount; ++i) {
+            math::Vector3<T> offset = mesh.getVertex(i) - wireframe.boundsCenter;
+            radiusSquared = std::max(radiusSquared, offset.dot(offset));
+        }
+        wireframe.boundsRadius = std::sqrt(radiusSquared);
+
+        std::vector<uint64_t> edges;
+        for (const auto& face : mesh.faces) {
+            if (face.size() < 3) continue;
+            for (size_t i = 0; i < face.size(); ++i) {
+                int a = face[i];
+                int b = face[(i + 1) % face.size()];
+                if (a < 0 || b < 0 || a == b ||
+                    static_cast<size_t>(a) >= vertexCount || static_cast<size_t>(b) >= vertexCount) {
+                    continue;
+                }
+                edges.push_back(packEdge(static_cast<uint32_t>(a), static_cast<uint32_t>(b)));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+        wireframe.edgeCount = edges.size();
+        if (edges.empty()) {
+            return wireframe;
+        }
+
+        // adjacency CSR: tiap vertex nyimpen (tetangga, id edge)
+        std::vector<size_t> adjacencyOffsets(vertexCount + 1, 0);
+        for (uint64_t edge : edges) {
+            ++adjacencyOffsets[(edge >> 32) + 1];
+            ++adjacencyOffsets[(edge & 0xFFFFFFFFu) + 1];
+        }
+        for (size_t i = 0; i < vertexCount; ++i) {
+            adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+        }
+        std::vector<std::pair<uint32_t, uint32_t>> adjacency(2 * edges.size());
+        std::vector<size_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t e = 0; e < edges.size(); ++e) {
+            uint32_t a = static_cast<uint32_t>(edges[e] >> 32);
+            uint32_t b = static_cast<uint32_t>(edges[e] & 0xFFFFFFFFu);
+            adjacency[cursor[a]++] = {b, static_cast<uint32_t>(e)};
+            adjacency[cursor[b]++] = {a, static_cast<uint32_t>(e)};
+        }
+
+        // rangkai edge secara greedy: jalan terus lewat edge yang belum dipakai sampai buntu. Mulai dari vertex
+        // berderajat ganjil dulu (ujung jalur Euler), jadi strip-nya lebih panjang
+        std::vector<bool> used(edges.size(), false);
+        std::copy(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1, cursor.begin());
+        auto walk = [&](uint32_t start) {
+            while (true) {
+                // cursor[start] cuma maju, jadi edge yang sudah dipakai dilewati sekali saja per vertex
+                while (cursor[start] < adjacencyOffsets[start + 1] && used[adjacency[cursor[start]].second]) {
+                    ++cursor[start];
+                }
+                if (cursor[start] == adjacencyOffsets[start + 1]) return;
+
+                wireframe.stripOffsets.push_back(wireframe.stripIndices.size());
+                wireframe.stripIndices.push_back(static_cast<int>(start));
+                uint32_t current = start;
+                while (true) {
+                    while (cursor[current] < adjacencyOffsets[current + 1] && used[adjacency[cursor[current]].second]) {
+                        ++cursor[current];
+                    }
+                    if (cursor[current] == adjacencyOffsets[current + 1]) break;
+                    const std::pair<uint32_t, uint32_t>& next = adjacency[cursor[current]];
+                    used[next.second] = true;
+                    current = next.first;
+                    wireframe.stripIndices.push_back(static_cast<int>(current));
+                }
+            }
+        };
+        for (size_t v = 0; v < vertexCount; ++v) {
+            if ((adjacencyOffsets[v + 1] - adjacencyOffsets[v]) % 2 == 1) walk(static_cast<uint32_t>(v));
+        }
+        for (size_t v = 0; v < vertexCount; ++v) {
+            walk(static_cast<uint32_t>(v));
+        }
+        wireframe.stripOffsets.push_back(wireframe.stripIndices.size());
+        return wireframe;
+    }
+
+    template struct Wireframe<float>;
+    template struct Wireframe<double>;
+
+} // namespace graphics
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "Mesh.hpp"
+#include "../math/Vector3.hpp"
+
+namespace graphics {
+    // bagian wireframe yang nggak bergantung pose, dibangun sekali per mesh lalu dipakai buat banyak model matrix
+    // (mis. ghost onion-skin): edge unik (edge yang dipakai dua face cuma digambar sekali) yang dirangkai jadi strip
+    // supaya satu strip = satu SDL_RenderDrawLines, dan bounding sphere di koordinat model buat nentuin perlu
+    // near-clip per edge atau nggak. Posisi nggak disalin: strip berisi index vertex mesh, dan drawWireframes membaca
+    // posisinya langsung dari mesh (mesh terkuantisasi tetap 16-bit, dekuantisasinya digabung ke mvp)
+    template<typename T>
+    struct Wireframe {
+        size_t vertexCount = 0;                    // mesh.vertexCount() waktu dibangun
+        std::vector<int> stripIndices;
+        std::vector<size_t> stripOffsets;          // strip k = stripIndices[stripOffsets[k], stripOffsets[k + 1])
+        size_t edgeCount = 0;
+        math::Vector3<T> boundsCenter;
+        T boundsRadius = static_cast<T>(0);
+
+        size_t stripCount() const {
+            return stripOffsets.empty() ? 0 : stripOffsets.size() - 1;
+        }
+
+        bool empty() const {
+            return edgeCount == 0;
+        }
+
+        // index face di luar range dilewati (drawMesh yang ngasih warning-nya)
+        static Wireframe build(const Mesh<T>& mesh);
+    };
+} // namespace graphics
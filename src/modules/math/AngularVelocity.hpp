@@ -0,0 +1,78 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include "Vector3.hpp"
+#include "Quaternion.hpp"
+#include "Renormalization.hpp"
+
+namespace math {
+    // Integrasi orientasi dengan kecepatan sudut konstan per langkah, timestep tetap (terlepas dari frame rate).
+    // Langkahnya peta eksponensial: q(t + h) = exp((0, omega * h / 2)) * q(t), omega di frame dunia (rad/s).
+    // Untuk omega konstan itu solusi persis, bukan pendekatan Euler, jadi n langkah yang numpuk di satu frame
+    // (frame telat/kelewat) dihitung sekaligus sebagai exp(omega * n * h / 2): hasilnya sama dengan n langkah
+    // satu-satu dan biayanya tetap O(1). Sisa waktu yang belum genap satu langkah disimpan di accumulator.
+    // Sesudah tiap advance quaternion dinormalisasi ulang dengan satu langkah Newton (tanpa sqrt)
+    template<typename T>
+    class AngularVelocityIntegrator {
+    public:
+        explicit AngularVelocityIntegrator(T stepSeconds = static_cast<T>(1) / static_cast<T>(240))
+            : stepSeconds(stepSeconds) {}
+
+        // mulai dari orientasi ini, accumulator & hitungan langkah di-reset
+        void reset(const Quaternion<T>& start) {
+            orientation = start;
+            accumulator = static_cast<T>(0);
+            stepCount = 0;
+        }
+
+        void setAngularVelocity(const Vector3<T>& radiansPerSecond) {
+            if (radiansPerSecond == angularVelocity) return;
+            angularVelocity = radiansPerSecond;
+            stepRotation = exponential(angularVelocity * stepSeconds);
+        }
+
+        // return jumlah langkah tetap yang dijalankan
+        uint64_t advance(T deltaTime) {
+            accumulator += deltaTime;
+            if (accumulator < stepSeconds) return 0;
+            uint64_t steps = static_cast<uint64_t>(accumulator / stepSeconds);
+            accumulator -= static_cast<T>(steps) * stepSeconds;
+            // pembulatan bisa bikin sisa sedikit di bawah nol atau tepat satu langkah
+            if (accumulator < static_cast<T>(0)) accumulator = static_cast<T>(0);
+
+            Quaternion<T> step = steps == 1 ? stepRotation : exponential(angularVelocity * (static_cast<T>(steps) * stepSeconds));
+            orientation = Renormalization<T>::fastNormalize(step * orientation);
+            stepCount += steps;
+            return steps;
+        }
+
+        // orientasi di langkah terakhir
+        const Quaternion<T>& getOrientation() const { return orientation; }
+
+        // orientasi di waktu sekarang (langkah terakhir + sisa accumulator), buat ditampilkan: gerakannya tetap
+        // mulus walau timestep simulasi nggak pas dengan frame
+        Quaternion<T> sampleOrientation() const {
+            return exponential(angularVelocity * accumulator) * orientation;
+        }
+
+        const Vector3<T>& getAngularVelocity() const { return angularVelocity; }
+        T getStepSeconds() const { return stepSeconds; }
+        uint64_t getStepCount() const { return stepCount; }
+        // waktu simulasi yang sudah dijalankan (tanpa sisa accumulator)
+        double getSimulatedTime() const { return static_cast<double>(stepCount) * static_cast<double>(stepSeconds); }
+
+        // exp((0, v / 2)): rotasi sebesar |v| radian di sumbu v / |v|
+        static Quaternion<T> exponential(const Vector3<T>& rotationVector) {
+            return Quaternion<T>(static_cast<T>(0), rotationVector.x / static_cast<T>(2),
+                                 rotationVector.y / static_cast<T>(2), rotationVector.z / static_cast<T>(2)).exp();
+        }
+
+    private:
+        T stepSeconds;
+        T accumulator = static_cast<T>(0);
+        uint64_t stepCount = 0;
+        Vector3<T> angularVelocity;
+        Quaternion<T> stepRotation;
+        Quaternion<T> orientation;
+    };
+} // namespace math
@@ -1,49 +1,106 @@
 #pragma once
 #include "Matrix4.hpp"
 #include "Vector3.hpp"
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "FastTrig.hpp"
 #include <cmath>
+#include <vector>
 
 namespace math {
-    
+    namespace detail {
+        // Rz(a) * Ry(b) * Rx(c) dari sin/cos ketiga sudut (s[0..2], c[0..2]); dipakai Euler ZYX & Tait-Bryan
+        template<typename T>
+        Matrix4<T> zyxMatrix(const T* s, const T* c) {
+            Matrix4<T> result(typename Matrix4<T>::ArrayType{
+                c[0] * c[1], c[0] * s[1] * s[2] - s[0] * c[2], c[0] * s[1] * c[2] + s[0] * s[2], static_cast<T>(0),
+                s[0] * c[1], s[0] * s[1] * s[2] + c[0] * c[2], s[0] * s[1] * c[2] - c[0] * s[2], static_cast<T>(0),
+                -s[1],       c[1] * s[2],                      c[1] * c[2],                      static_cast<T>(0),
+                static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1)});
+            result.setKind(MatrixKind::ROTATION);
+            return result;
+        }
+
+        // sama dengan qz(a) * qy(b) * qx(c); s & c di sini dari SETENGAH sudut
+        template<typename T>
+        Quaternion<T> zyxQuaternion(const T* s, const T* c) {
+            return Quaternion<T>(c[0] * c[1] * c[2] + s[0] * s[1] * s[2],
+                                 c[0] * c[1] * s[2] - s[0] * s[1] * c[2],
+                                 c[0] * s[1] * c[2] + s[0] * c[1] * s[2],
+                                 s[0] * c[1] * c[2] - c[0] * s[1] * s[2]);
+        }
+
+        // sin/cos semua sudut (derajat, x/y/z tiap triple) dalam satu panggilan FastTrig batch;
+        // scale = 1 buat matriks, 0.5 buat quaternion
+        template<typename T>
+        void sincosTriples(const std::vector<Vector3<T>>& angles, T scale, std::vector<T>& sines, std::vector<T>& cosines) {
+            const T factor = FastTrig<T>::DEGREES_TO_RADIANS * scale;
+            std::vector<T> radians(angles.size() * 3);
+            for (size_t i = 0; i < angles.size(); ++i) {
+                radians[i * 3] = angles[i].x * factor;
+                radians[i * 3 + 1] = angles[i].y * factor;
+                radians[i * 3 + 2] = angles[i].z * factor;
+            }
+            sines.resize(radians.size());
+            cosines.resize(radians.size());
+            FastTrig<T>::sincos(radians.data(), sines.data(), cosines.data(), radians.size());
+        }
+
+        template<typename T>
+        void sincosTriple(T a, T b, T c, T scale, T* sines, T* cosines) {
+            const T factor = FastTrig<T>::DEGREES_TO_RADIANS * scale;
+            FastTrig<T>::sincos(a * factor, sines[0], cosines[0]);
+            FastTrig<T>::sincos(b * factor, sines[1], cosines[1]);
+            FastTrig<T>::sincos(c * factor, sines[2], cosines[2]);
+        }
+
+        template<typename T>
+        void zyxMatrices(const std::vector<Vector3<T>>& angles, std::vector<Matrix4<T>>& out) {
+            std::vector<T> sines, cosines;
+            sincosTriples(angles, static_cast<T>(1), sines, cosines);
+            out.resize(angles.size());
+            for (size_t i = 0; i < angles.size(); ++i) {
+                out[i] = zyxMatrix(&sines[i * 3], &cosines[i * 3]);
+            }
+        }
+
+        template<typename T>
+        void zyxQuaternions(const std::vector<Vector3<T>>& angles, QuaternionArray<T>& out) {
+            std::vector<T> sines, cosines;
+            sincosTriples(angles, static_cast<T>(0.5), sines, cosines);
+            out.resize(angles.size());
+            for (size_t i = 0; i < angles.size(); ++i) {
+                out.set(i, zyxQuaternion(&sines[i * 3], &cosines[i * 3]));
+            }
+        }
+    } // namespace detail
+
+    // Semua sudut dalam derajat. Versi batch (vector of (alpha, beta, gamma) / (yaw, pitch, roll)) menghitung
+    // semua sin/cos lewat satu panggilan FastTrig, jadi sweep ribuan orientasi cuma beberapa mikrodetik;
+    // hasilnya sama dengan versi satuan
     template<typename T>
     class EulerAngles {
     public:
         
         static Matrix4<T> fromZYX(T alpha, T beta, T gamma) {
-            
-            T alphaRad = alpha * static_cast<T>(M_PI) / static_cast<T>(180.0);
-            T betaRad = beta * static_cast<T>(M_PI) / static_cast<T>(180.0);
-            T gammaRad = gamma * static_cast<T>(M_PI) / static_cast<T>(180.0);
-            
-            
-            T ca = std::cos(alphaRad), sa = std::sin(alphaRad);
-            T cb = std::cos(betaRad),  sb = std::sin(betaRad);
-            T cg = std::cos(gammaRad), sg = std::sin(gammaRad);
-            
-            
-            Matrix4<T> result;
-            
-            result(0, 0) = ca * cb;
-            result(0, 1) = ca * sb * sg - sa * cg;
-            result(0, 2) = ca * sb * cg + sa * sg;
-            result(0, 3) = static_cast<T>(0);
-            
-            result(1, 0) = sa * cb;
-            result(1, 1) = sa * sb * sg + ca * cg;
-            result(1, 2) = sa * sb * cg - ca * sg;
-            result(1, 3) = static_cast<T>(0);
-            
-            result(2, 0) = -sb;
-            result(2, 1) = cb * sg;
-            result(2, 2) = cb * cg;
-            result(2, 3) = static_cast<T>(0);
-            
-            result(3, 0) = static_cast<T>(0);
-            result(3, 1) = static_cast<T>(0);
-            result(3, 2) = static_cast<T>(0);
-            result(3, 3) = static_cast<T>(1);
-            
-            return result;
+            T s[3], c[3];
+            detail::sincosTriple(alpha, beta, gamma, static_cast<T>(1), s, c);
+            return detail::zyxMatrix(s, c);
+        }
+
+        // angles[i] = (alpha, beta, gamma)
+        static void fromZYX(const std::vector<Vector3<T>>& angles, std::vector<Matrix4<T>>& out) {
+            detail::zyxMatrices(angles, out);
+        }
+
+        static Quaternion<T> toQuaternion(T alpha, T beta, T gamma) {
+            T s[3], c[3];
+            detail::sincosTriple(alpha, beta, gamma, static_cast<T>(0.5), s, c);
+            return detail::zyxQuaternion(s, c);
+        }
+
+        static void toQuaternions(const std::vector<Vector3<T>>& angles, QuaternionArray<T>& out) {
+            detail::zyxQuaternions(angles, out);
         }
         
         
@@ -53,13 +110,12 @@ namespace math {
             zAxis = Vector3<T>(0, 0, 1);
             
             
-            T alphaRad = alpha * static_cast<T>(M_PI) / static_cast<T>(180.0);
-            T ca = std::cos(alphaRad), sa = std::sin(alphaRad);
+            T sa, ca, sb, cb;
+            FastTrig<T>::sincos(alpha * FastTrig<T>::DEGREES_TO_RADIANS, sa, ca);
             yAxis = Vector3<T>(-sa, ca, 0);
             
             
-            T betaRad = beta * static_cast<T>(M_PI) / static_cast<T>(180.0);
-            T cb = std::cos(betaRad), sb = std::sin(betaRad);
+            FastTrig<T>::sincos(beta * FastTrig<T>::DEGREES_TO_RADIANS, sb, cb);
             
             T xAxisX = ca * cb;
             T xAxisY = sa * cb;
@@ -73,50 +129,32 @@ namespace math {
     public:
         
         static Matrix4<T> fromYawPitchRoll(T yaw, T pitch, T roll) {
-            
-            T yawRad = yaw * static_cast<T>(M_PI) / static_cast<T>(180.0);
-            T pitchRad = pitch * static_cast<T>(M_PI) / static_cast<T>(180.0);
-            T rollRad = roll * static_cast<T>(M_PI) / static_cast<T>(180.0);
-            
-            
-            T cy = std::cos(yawRad),   sy = std::sin(yawRad);
-            T cp = std::cos(pitchRad), sp = std::sin(pitchRad);
-            T cr = std::cos(rollRad),  sr = std::sin(rollRad);
-            
-            
-            Matrix4<T> result;
-            
-            result(0, 0) = cy * cp;
-            result(0, 1) = cy * sp * sr - sy * cr;
-            result(0, 2) = cy * sp * cr + sy * sr;
-            result(0, 3) = static_cast<T>(0);
-            
-            result(1, 0) = sy * cp;
-            result(1, 1) = sy * sp * sr + cy * cr;
-            result(1, 2) = sy * sp * cr - cy * sr;
-            result(1, 3) = static_cast<T>(0);
-            
-            result(2, 0) = -sp;
-            result(2, 1) = cp * sr;
-            result(2, 2) = cp * cr;
-            result(2, 3) = static_cast<T>(0);
-            
-            result(3, 0) = static_cast<T>(0);
-            result(3, 1) = static_cast<T>(0);
-            result(3, 2) = static_cast<T>(0);
-            result(3, 3) = static_cast<T>(1);
-            
-            return result;
+            T s[3], c[3];
+            detail::sincosTriple(yaw, pitch, roll, static_cast<T>(1), s, c);
+            return detail::zyxMatrix(s, c);
+        }
+
+        // angles[i] = (yaw, pitch, roll)
+        static void fromYawPitchRoll(const std::vector<Vector3<T>>& angles, std::vector<Matrix4<T>>& out) {
+            detail::zyxMatrices(angles, out);
+        }
+
+        static Quaternion<T> toQuaternion(T yaw, T pitch, T roll) {
+            T s[3], c[3];
+            detail::sincosTriple(yaw, pitch, roll, static_cast<T>(0.5), s, c);
+            return detail::zyxQuaternion(s, c);
+        }
+
+        static void toQuaternions(const std::vector<Vector3<T>>& angles, QuaternionArray<T>& out) {
+            detail::zyxQuaternions(angles, out);
         }
         
         
         static void getRotationAxes(T yaw, T pitch, T roll,
                                    Vector3<T>& yawAxis, Vector3<T>& pitchAxis, Vector3<T>& rollAxis) {
-            T yawRad = yaw * static_cast<T>(M_PI) / static_cast<T>(180.0);
-            T pitchRad = pitch * static_cast<T>(M_PI) / static_cast<T>(180.0);
-            
-            T cy = std::cos(yawRad), sy = std::sin(yawRad);
-            T cp = std::cos(pitchRad), sp = std::sin(pitchRad);
+            T sy, cy, sp, cp;
+            FastTrig<T>::sincos(yaw * FastTrig<T>::DEGREES_TO_RADIANS, sy, cy);
+            FastTrig<T>::sincos(pitch * FastTrig<T>::DEGREES_TO_RADIANS, sp, cp);
             
             
             yawAxis = Vector3<T>(0, 0, 1);
@@ -0,0 +1,139 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "SimdKernels.hpp"
+
+namespace math {
+    // sin & cos sekaligus pakai satu reduksi argumen + dua polinomial (lihat simd::detail::SinCosStep).
+    // Versi skalar dan kernel SIMD memakai implementasi yang sama, jadi hasil batch = hasil per elemen
+    // (selisihnya cuma dari FMA di AVX2).
+    //
+    // Akurasi (diukur terhadap std::sin/std::cos, error absolut):
+    //   float : |x| <= 1e4 rad -> <= 1.5e-7 (~1 ulp di sekitar 1); di atas itu reduksinya mulai kehilangan bit
+    //   double: |x| <= 1e6 rad -> <= 3e-16  (~1 ulp di sekitar 1)
+    // Sudut di luar MAX_ACCURATE_ANGLE (termasuk inf/NaN) tetap aman, tapi jatuh ke std::sin/std::cos
+    //
+    // atan2 (simd::detail::Atan2Step): error <= 2.5e-7 (float) / 4.5e-16 (double) rad. Input di atas MAX_ATAN2_INPUT
+    // (termasuk inf/NaN) jatuh ke std::atan2; beda lain dengan std: tanda nol diabaikan (atan2(0, -0) = 0)
+    template<typename T>
+    class FastTrig {
+    public:
+        static constexpr T MAX_ACCURATE_ANGLE = sizeof(T) == sizeof(float) ? static_cast<T>(1e4) : static_cast<T>(1e6);
+        static constexpr T DEGREES_TO_RADIANS = static_cast<T>(0.017453292519943295769236907684886);
+        static constexpr T RADIANS_TO_DEGREES = static_cast<T>(57.295779513082320876798154814105);
+        // |x| + |y| nggak boleh overflow
+        static constexpr T MAX_ATAN2_INPUT = std::numeric_limits<T>::max() / static_cast<T>(4);
+
+        static void sincos(T angle, T& sine, T& cosine) {
+            if (!(std::abs(angle) <= MAX_ACCURATE_ANGLE)) {
+                sine = std::sin(angle);
+                cosine = std::cos(angle);
+                return;
+            }
+            simd::detail::SinCosStep<simd::detail::ScalarLanes<T>>::apply(angle, sine, cosine);
+        }
+
+        // array radian; sines/cosines nggak boleh menimpa angles
+        static void sincos(const T* angles, T* sines, T* cosines, size_t count) {
+            size_t done = kernels().sincos ? kernels().sincos(angles, sines, cosines, count) : 0;
+            // kernel SIMD nggak ngecek rentang; elemen di luar MAX_ACCURATE_ANGLE dihitung ulang (jarang terjadi).
+            // Pengecekannya OR tanpa cabang supaya ikut divektorisasi compiler
+            unsigned outOfRange = 0;
+            for (size_t i = 0; i < done; ++i) {
+                outOfRange |= !(std::abs(angles[i]) <= MAX_ACCURATE_ANGLE);
+            }
+            if (outOfRange) {
+                for (size_t i = 0; i < done; ++i) {
+                    if (!(std::abs(angles[i]) <= MAX_ACCURATE_ANGLE)) {
+                        sines[i] = std::sin(angles[i]);
+                        cosines[i] = std::cos(angles[i]);
+                    }
+                }
+            }
+            for (size_t i = done; i < count; ++i) {
+                sincos(angles[i], sines[i], cosines[i]);
+            }
+        }
+
+        static T atan2(T y, T x) {
+            if (!(std::abs(y) <= MAX_ATAN2_INPUT && std::abs(x) <= MAX_ATAN2_INPUT)) {
+                return std::atan2(y, x);
+            }
+            T angle;
+            simd::detail::Atan2Step<simd::detail::ScalarLanes<T>>::apply(y, x, angle);
+            return angle;
+        }
+
+        // out nggak boleh menimpa y/x
+        static void atan2(const T* y, const T* x, T* out, size_t count) {
+            size_t done = kernels().atan2 ? kernels().atan2(y, x, out, count) : 0;
+            unsigned outOfRange = 0;
+            for (size_t i = 0; i < done; ++i) {
+                // | bukan || supaya nggak jadi cabang
+                outOfRange |= static_cast<unsigned>(!(std::abs(y[i]) <= MAX_ATAN2_INPUT)) | static_cast<unsigned>(!(std::abs(x[i]) <= MAX_ATAN2_INPUT));
+            }
+            if (outOfRange) {
+                for (size_t i = 0; i < done; ++i) {
+                    if (!(std::abs(y[i]) <= MAX_ATAN2_INPUT && std::abs(x[i]) <= MAX_ATAN2_INPUT)) {
+                        out[i] = std::atan2(y[i], x[i]);
+                    }
+                }
+            }
+            for (size_t i = done; i < count; ++i) {
+                out[i] = atan2(y[i], x[i]);
+            }
+        }
+
+        static const simd::TrigKernels<T>& kernels() {
+            static const simd::TrigKernels<T> selected = selectKernels();
+            return selected;
+        }
+
+    private:
+        static simd::TrigKernels<T> selectKernels() {
+            for (const auto& candidate : simd::trigKernelCandidates<T>()) {
+                if (verifyKernels(candidate)) {
+                    return candidate;
+                }
+                std::cerr << "[FastTrig] kernel " << candidate.name << " tidak cocok dengan versi skalar, dilewati." << std::endl;
+            }
+            return simd::TrigKernels<T>();
+        }
+
+        static bool verifyKernels(const simd::TrigKernels<T>& candidate) {
+            const T tolerance = sizeof(T) == sizeof(float) ? static_cast<T>(1e-6) : static_cast<T>(1e-14);
+            // semua kuadran, positif & negatif, plus beberapa sudut besar
+            const size_t count = 32;
+            std::vector<T> angles(count), sines(count), cosines(count);
+            for (size_t i = 0; i < count; ++i) {
+                angles[i] = (static_cast<T>(i) - static_cast<T>(16)) * static_cast<T>(0.7);
+            }
+            angles[3] = static_cast<T>(1000.25);
+            angles[7] = static_cast<T>(-4321.5);
+
+            size_t done = candidate.sincos(angles.data(), sines.data(), cosines.data(), count);
+            for (size_t i = 0; i < done; ++i) {
+                T sine, cosine;
+                sincos(angles[i], sine, cosine);
+                if (std::abs(sine - sines[i]) > tolerance || std::abs(cosine - cosines[i]) > tolerance) return false;
+            }
+
+            // pasangan (sin, cos) di atas + sumbu & titik nol -> semua oktan dan kasus pinggir
+            std::vector<T> results(count);
+            sines[0] = cosines[0] = static_cast<T>(0);
+            sines[1] = static_cast<T>(0);
+            cosines[2] = static_cast<T>(0);
+            if (!candidate.atan2) return false;
+            done = candidate.atan2(sines.data(), cosines.data(), results.data(), count);
+            for (size_t i = 0; i < done; ++i) {
+                if (std::abs(atan2(sines[i], cosines[i]) - results[i]) > tolerance) return false;
+            }
+            return true;
+        }
+    };
+} // namespace math
@@ -0,0 +1,140 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include "Vector3.hpp"
+#include "Matrix4.hpp"
+#include "RotationConversion.hpp"
+#include "FastTrig.hpp"
+
+namespace math {
+    // Hasil sweep satu sudut dari -180..180 (atau rangeStart..rangeEnd) sementara dua sudut lain ditahan.
+    // Semua array panjangnya sama (satu elemen per sampel)
+    template<typename T>
+    struct GimbalSweep {
+        AxisOrder order = AxisOrder::ZYX; // intrinsic (ZYX = EulerAngles::fromZYX / TaitBryanAngles)
+        int parameter = 0;          // sudut yang di-sweep: 0, 1, atau 2 (urutan sumbunya)
+        Vector3<T> heldAngles;      // derajat; komponen ke-parameter diabaikan
+        T rangeStart = static_cast<T>(-180);
+        T rangeEnd = static_cast<T>(180);
+
+        std::vector<T> angles;                      // nilai sudut yang di-sweep (derajat)
+        std::vector<Matrix4<T>> rotations;
+        std::vector<Vector3<T>> axisX, axisY, axisZ; // sumbu lokal model sesudah dirotasi = lintasan yang digambar
+        // kondisi Jacobian d(omega)/d(sudut); makin besar makin dekat gimbal lock, inf = tepat di gimbal lock
+        std::vector<T> conditionNumbers;
+
+        size_t size() const { return angles.size(); }
+    };
+
+    template<typename T>
+    class GimbalSweeper {
+    public:
+        // potongan yang wajar buat dibagi ke thread (per potongan: satu panggilan FastTrig batch)
+        static constexpr size_t CHUNK_SIZE = 256;
+
+        // ukuran array & nilai sudut; sesudah ini computeRange boleh dipanggil paralel buat rentang yang berbeda
+        static void prepare(GimbalSweep<T>& sweep, size_t sampleCount) {
+            sweep.angles.resize(sampleCount);
+            sweep.rotations.resize(sampleCount);
+            sweep.axisX.resize(sampleCount);
+            sweep.axisY.resize(sampleCount);
+            sweep.axisZ.resize(sampleCount);
+            sweep.conditionNumbers.resize(sampleCount);
+
+            T step = sampleCount > 1 ? (sweep.rangeEnd - sweep.rangeStart) / static_cast<T>(sampleCount - 1) : static_cast<T>(0);
+            for (size_t i = 0; i < sampleCount; ++i) {
+                sweep.angles[i] = sweep.rangeStart + step * static_cast<T>(i);
+            }
+        }
+
+        static void computeRange(GimbalSweep<T>& sweep, size_t begin, size_t end) {
+            if (begin >= end) return;
+            const size_t count = end - begin;
+            const T toRadians = FastTrig<T>::DEGREES_TO_RADIANS;
+            T held[3] = {sweep.heldAngles.x * toRadians, sweep.heldAngles.y * toRadians, sweep.heldAngles.z * toRadians};
+
+            // triple sudut semua sampel -> satu panggilan sincos batch
+            std::vector<T> radians(count * 3), sines(count * 3), cosines(count * 3);
+            for (size_t i = 0; i < count; ++i) {
+                for (int k = 0; k < 3; ++k) {
+                    radians[i * 3 + k] = k == sweep.parameter ? sweep.angles[begin + i] * toRadians : held[k];
+                }
+            }
+            FastTrig<T>::sincos(radians.data(), sines.data(), cosines.data(), radians.size());
+
+            for (size_t i = 0; i < count; ++i) {
+                const T* s = &sines[i * 3];
+                const T* c = &cosines[i * 3];
+                size_t index = begin + i;
+
+                const Matrix4<T>& rotation = sweep.rotations[index] = buildRotation(sweep.order, s, c);
+                sweep.axisX[index] = Vector3<T>(rotation(0, 0), rotation(1, 0), rotation(2, 0));
+                sweep.axisY[index] = Vector3<T>(rotation(0, 1), rotation(1, 1), rotation(2, 1));
+                sweep.axisZ[index] = Vector3<T>(rotation(0, 2), rotation(1, 2), rotation(2, 2));
+
+                Vector3<T> first, second, third;
+                jacobianAxes(sweep.order, s, c, first, second, third);
+                sweep.conditionNumbers[index] = conditionNumber(first, second, third);
+            }
+        }
+
+        static void compute(GimbalSweep<T>& sweep, size_t sampleCount) {
+            prepare(sweep, sampleCount);
+            computeRange(sweep, 0, sampleCount);
+        }
+
+        static Matrix4<T> buildRotation(AxisOrder order, const T* s, const T* c) {
+            return detail::axisOrderMatrix(detail::axisSequence(order), s, c);
+        }
+
+        // sumbu putar tiap sudut di koordinat dunia: omega = d1 * first + d2 * second + d3 * third,
+        // jadi ketiganya kolom Jacobian kecepatan sudut. Urutan (i, j, k): e_i, Ri * e_j, Ri * Rj * e_k
+        // (buat ZYX sama dengan EulerAngles::getRotationAxes)
+        static void jacobianAxes(AxisOrder order, const T* s, const T* c,
+                                 Vector3<T>& first, Vector3<T>& second, Vector3<T>& third) {
+            detail::AxisSequence axes = detail::axisSequence(order);
+            T axis[3][3] = {};
+            axis[0][axes.first] = static_cast<T>(1);
+            axis[1][axes.second] = static_cast<T>(1);
+            axis[2][axes.third] = static_cast<T>(1);
+            detail::rotateAboutAxis(axes.first, s[0], c[0], axis[1]);
+            detail::rotateAboutAxis(axes.second, s[1], c[1], axis[2]);
+            detail::rotateAboutAxis(axes.first, s[0], c[0], axis[2]);
+            first = Vector3<T>(axis[0][0], axis[0][1], axis[0][2]);
+            second = Vector3<T>(axis[1][0], axis[1][1], axis[1][2]);
+            third = Vector3<T>(axis[2][0], axis[2][1], axis[2][2]);
+        }
+
+        // kondisi matriks dengan kolom a, b, c = sqrt(lambda_max / lambda_min) dari Gram matrix-nya
+        // (nilai eigen simetris 3x3 bentuk tertutup). Kolom yang sebidang -> inf
+        static T conditionNumber(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& c) {
+            T g00 = a.dot(a), g11 = b.dot(b), g22 = c.dot(c);
+            T g01 = a.dot(b), g02 = a.dot(c), g12 = b.dot(c);
+
+            T largest, smallest;
+            T offDiagonal = g01 * g01 + g02 * g02 + g12 * g12;
+            if (offDiagonal == static_cast<T>(0)) {
+                largest = std::max(g00, std::max(g11, g22));
+                smallest = std::min(g00, std::min(g11, g22));
+            } else {
+                T q = (g00 + g11 + g22) / static_cast<T>(3);
+                T d0 = g00 - q, d1 = g11 - q, d2 = g22 - q;
+                T p = std::sqrt((d0 * d0 + d1 * d1 + d2 * d2 + static_cast<T>(2) * offDiagonal) / static_cast<T>(6));
+                // det((G - qI) / p) / 2
+                T determinant = d0 * (d1 * d2 - g12 * g12) - g01 * (g01 * d2 - g12 * g02) + g02 * (g01 * g12 - d1 * g02);
+                T r = std::clamp(determinant / (static_cast<T>(2) * p * p * p), static_cast<T>(-1), static_cast<T>(1));
+                T phi = std::acos(r) / static_cast<T>(3);
+                largest = q + static_cast<T>(2) * p * std::cos(phi);
+                smallest = q + static_cast<T>(2) * p * std::cos(phi + static_cast<T>(2.0943951023931954923));
+            }
+
+            if (!(smallest > largest * std::numeric_limits<T>::epsilon())) {
+                return std::numeric_limits<T>::infinity();
+            }
+            return std::sqrt(largest / smallest);
+        }
+    };
+} // namespace math
@@ -1,10 +1,25 @@
 #pragma once
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
 #include "Vector4.hpp"
 #include "Quaternion.hpp"
+#include "SimdKernels.hpp"
 
 namespace math {
+    // struktur matriks, urut dari yang paling sempit. Hasil kali dua matriks = max dari keduanya
+    // (rotasi * translasi = rigid, rigid * skala = affine, apa pun * proyeksi = projective)
+    enum class MatrixKind : uint8_t {
+        IDENTITY = 0,
+        ROTATION = 1,   // 3x3 ortonormal, tanpa translasi
+        RIGID = 2,      // rotasi + translasi
+        AFFINE = 3,     // baris terakhir (0, 0, 0, 1)
+        PROJECTIVE = 4  // umum
+    };
+
     template<typename T>
     class Matrix4 {
     public:
@@ -12,7 +27,7 @@ namespace math {
         using ArrayType = std::array<T, 16>;
 
         // ctor (matriks identitas)
-        Matrix4() : data{} {
+        Matrix4() : data{}, kind(MatrixKind::IDENTITY) {
             for (int i = 0; i < 16; ++i) {
                 data[i] = (i % 5 == 0) ? static_cast<T>(1) : static_cast<T>(0);
             }
@@ -20,10 +35,12 @@ namespace math {
         // ctor (dari array)
         explicit Matrix4(const ArrayType& arr) : data(arr) {}
         // cctor
-        Matrix4(const Matrix4& other) : data(other.data) {}
+        Matrix4(const Matrix4& other) : data(other.data), kind(other.kind) {}
+        Matrix4& operator=(const Matrix4& other) = default;
         
-        // assignment
+        // assignment (nulis lewat sini bikin matriksnya dianggap umum lagi)
         T& operator()(int row, int col) {
+            kind = MatrixKind::PROJECTIVE;
             return data[row * 4 + col];
         }
         const T& operator()(int row, int col) const {
@@ -42,16 +59,47 @@ namespace math {
         }
         void setData(const ArrayType& arr) {
             data = arr;
+            kind = MatrixKind::PROJECTIVE;
         }
         void setAt(int x, int y, ValueType value) {
             if (x < 0 || x >= 4 || y < 0 || y >= 4) {
                 throw std::out_of_range("[Matrix4] indeks di luar jangkauan.");
             }
             data[x * 4 + y] = value;
+            kind = MatrixKind::PROJECTIVE;
+        }
+
+        MatrixKind getKind() const {
+            return kind;
+        }
+        // buat builder di luar kelas ini (mis. EulerAngles) yang tahu pasti struktur hasilnya;
+        // pemanggil yang menjamin isinya memang sesuai
+        void setKind(MatrixKind newKind) {
+            kind = newKind;
         }
 
         // operator overloading
         Matrix4 operator*(const Matrix4& other) const {
+            if (kind == MatrixKind::IDENTITY) return other;
+            if (other.kind == MatrixKind::IDENTITY) return *this;
+            MatrixKind combined = std::max(kind, other.kind);
+
+            // kernel SIMD 4x4 penuh masih lebih cepat dari versi affine skalar (diukur), jadi struktur
+            // cuma diteruskan ke hasilnya. Baris (0, 0, 0, 1) tetap eksak karena perkalian dengan nol
+            const auto& simdKernels = kernels();
+            if (simdKernels.multiply) {
+                Matrix4 result(UNINITIALIZED);
+                simdKernels.multiply(data.data(), other.data.data(), result.data.data());
+                result.kind = combined;
+                return result;
+            }
+            if (combined <= MatrixKind::AFFINE) {
+                return multiplyAffine(other, combined);
+            }
+            return multiplyScalar(other);
+        }
+        // versi referensi, dipakai juga buat ngecek kernel SIMD
+        Matrix4 multiplyScalar(const Matrix4& other) const {
             Matrix4 result;
             for (int i = 0; i < 4; ++i) {
                 for (int j = 0; j < 4; ++j) {
@@ -69,7 +117,7 @@ namespace math {
         }
 
         Matrix4 operator+(const Matrix4& other) const {
-            Matrix4 result;
+            Matrix4 result(UNINITIALIZED);
             for (int i = 0; i < 16; ++i) {
                 result.data[i] = this->data[i] + other.data[i];
             }
@@ -79,11 +127,12 @@ namespace math {
             for (int i = 0; i < 16; ++i) {
                 this->data[i] += other.data[i];
             }
+            kind = MatrixKind::PROJECTIVE;
             return *this;
         }
 
         Matrix4 operator-(const Matrix4& other) const {
-            Matrix4 result;
+            Matrix4 result(UNINITIALIZED);
             for (int i = 0; i < 16; ++i) {
                 result.data[i] = this->data[i] - other.data[i];
             }
@@ -93,11 +142,12 @@ namespace math {
             for (int i = 0; i < 16; ++i) {
                 this->data[i] -= other.data[i];
             }
+            kind = MatrixKind::PROJECTIVE;
             return *this;
         }
 
         Matrix4 operator*(T scalar) const {
-            Matrix4 result;
+            Matrix4 result(UNINITIALIZED);
             for (int i = 0; i < 16; ++i) {
                 result.data[i] = this->data[i] * scalar;
             }
@@ -107,6 +157,7 @@ namespace math {
             for (int i = 0; i < 16; ++i) {
                 this->data[i] *= scalar;
             }
+            kind = MatrixKind::PROJECTIVE;
             return *this;
         }
 
@@ -114,7 +165,7 @@ namespace math {
             if (scalar == static_cast<T>(0)) {
                 throw std::runtime_error("[Matrix4] pembagian dengan nol.");
             }
-            Matrix4 result;
+            Matrix4 result(UNINITIALIZED);
             for (int i = 0; i < 16; ++i) {
                 result.data[i] = this->data[i] / scalar;
             }
@@ -127,6 +178,7 @@ namespace math {
             for (int i = 0; i < 16; ++i) {
                 this->data[i] /= scalar;
             }
+            kind = MatrixKind::PROJECTIVE;
             return *this;
         }
 
@@ -137,15 +189,61 @@ namespace math {
             return !(*this == other);
         }
 
+    // satu vektor tetap skalar & inline (lebih cepat dari dispatch); buat banyak vektor pakai transformBatch
     Vector4<T> operator*(const Vector4<T>& vector) const {
+        if (kind == MatrixKind::IDENTITY) return vector;
         Vector4<T> result;
         result.x() = (*this)(0, 0) * vector.x() + (*this)(0, 1) * vector.y() + (*this)(0, 2) * vector.z() + (*this)(0, 3) * vector.w();
         result.y() = (*this)(1, 0) * vector.x() + (*this)(1, 1) * vector.y() + (*this)(1, 2) * vector.z() + (*this)(1, 3) * vector.w();
         result.z() = (*this)(2, 0) * vector.x() + (*this)(2, 1) * vector.y() + (*this)(2, 2) * vector.z() + (*this)(2, 3) * vector.w();
-        result.w() = (*this)(3, 0) * vector.x() + (*this)(3, 1) * vector.y() + (*this)(3, 2) * vector.z() + (*this)(3, 3) * vector.w();
+        // baris terakhir affine = (0, 0, 0, 1)
+        result.w() = kind <= MatrixKind::AFFINE
+            ? vector.w()
+            : (*this)(3, 0) * vector.x() + (*this)(3, 1) * vector.y() + (*this)(3, 2) * vector.z() + (*this)(3, 3) * vector.w();
         return result;
     }
 
+    // titik (w = 1); pembagian perspektif cuma dilakukan kalau matriksnya projective
+    Vector3<T> transformPoint(const Vector3<T>& point) const {
+        if (kind == MatrixKind::IDENTITY) return point;
+        Vector3<T> result(
+            data[0] * point.x + data[1] * point.y + data[2] * point.z + data[3],
+            data[4] * point.x + data[5] * point.y + data[6] * point.z + data[7],
+            data[8] * point.x + data[9] * point.y + data[10] * point.z + data[11]
+        );
+        if (kind <= MatrixKind::AFFINE) return result;
+        T w = data[12] * point.x + data[13] * point.y + data[14] * point.z + data[15];
+        if (w == static_cast<T>(0)) return result;
+        return Vector3<T>(result.x / w, result.y / w, result.z / w);
+    }
+
+    // arah (w = 0): translasi diabaikan
+    Vector3<T> transformDirection(const Vector3<T>& direction) const {
+        if (kind == MatrixKind::IDENTITY) return direction;
+        return Vector3<T>(
+            data[0] * direction.x + data[1] * direction.y + data[2] * direction.z,
+            data[4] * direction.x + data[5] * direction.y + data[6] * direction.z,
+            data[8] * direction.x + data[9] * direction.y + data[10] * direction.z
+        );
+    }
+
+    // out[i] = (*this) * in[i]; in dan out boleh sama
+    void transformBatch(const Vector4<T>* in, Vector4<T>* out, size_t count) const {
+        static_assert(sizeof(Vector4<T>) == 4 * sizeof(T), "Vector4 harus 4 komponen rapat");
+        if (kind == MatrixKind::IDENTITY) {
+            if (in != out) std::copy(in, in + count, out);
+            return;
+        }
+        const auto& simdKernels = kernels();
+        if (simdKernels.transformVectors) {
+            simdKernels.transformVectors(data.data(), reinterpret_cast<const T*>(in), reinterpret_cast<T*>(out), count);
+            return;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = (*this) * in[i];
+        }
+    }
+
     // operasi thd matriksnya sendiri
     Matrix4 transpose() const {
         Matrix4 result;
@@ -154,13 +252,42 @@ namespace math {
                 result(i, j) = this->operator()(j, i);
             }
         }
+        // transpose rotasi = rotasi (inversnya); struktur lain nggak bertahan
+        if (kind <= MatrixKind::ROTATION) {
+            result.kind = kind;
+        }
         return result;
     }
 
 
+    // matriks singular -> identitas.
+    // rotasi: transpose, rigid: [R^T | -R^T t], affine: invers 3x3 + translasi; sisanya invers 4x4 penuh
     Matrix4 inverse() const {
+        switch (kind) {
+        case MatrixKind::IDENTITY:
+            return Matrix4();
+        case MatrixKind::ROTATION:
+        case MatrixKind::RIGID:
+            return inverseRigid();
+        case MatrixKind::AFFINE:
+            return inverseAffine();
+        default:
+            break;
+        }
+
+        const auto& simdKernels = kernels();
+        if (simdKernels.inverse) {
+            Matrix4 result(UNINITIALIZED);
+            if (!simdKernels.inverse(data.data(), result.data.data())) {
+                return Matrix4();
+            }
+            return result;
+        }
+        return inverseScalar();
+    }
+    Matrix4 inverseScalar() const {
         T det;
-        Matrix4 result;
+        Matrix4 result(UNINITIALIZED);
 
         result.data[0] = data[5]  * data[10] * data[15] - 
                          data[5]  * data[11] * data[14] - 
@@ -299,6 +426,7 @@ namespace math {
         result(0, 3)= v.x;
         result(1, 3)= v.y;
         result(2, 3)= v.z;
+        result.kind = MatrixKind::RIGID;
         return result;
     }
 
@@ -307,6 +435,7 @@ namespace math {
         result(0, 0) = s.x;
         result(1, 1) = s.y;
         result(2, 2) = s.z;
+        result.kind = MatrixKind::AFFINE;
         return result;
     }
 
@@ -338,9 +467,35 @@ namespace math {
         result(3, 1) = static_cast<T>(0);
         result(3, 2) = static_cast<T>(0);
         result(3, 3) = static_cast<T>(1);
+        // quaternion yang nggak unit menghasilkan matriks yang nggak ortonormal
+        T norm = q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z;
+        result.kind = std::abs(norm - static_cast<T>(1)) <= ROTATION_TOLERANCE ? MatrixKind::ROTATION : MatrixKind::AFFINE;
         return result;
     }
 
+    // bagian rotasi (3x3 kiri atas, dianggap ortonormal) -> quaternion unit, metode Shepperd
+    // (pilih komponen terbesar dulu supaya nggak bagi dengan angka kecil)
+    Quaternion<T> toQuaternion() const {
+        T m00 = data[0], m11 = data[5], m22 = data[10];
+        T trace = m00 + m11 + m22;
+        T one = static_cast<T>(1);
+        Quaternion<T> q;
+        if (trace > static_cast<T>(0)) {
+            T s = std::sqrt(trace + one) * static_cast<T>(2);
+            q = Quaternion<T>(static_cast<T>(0.25) * s, (data[9] - data[6]) / s, (data[2] - data[8]) / s, (data[4] - data[1]) / s);
+        } else if (m00 > m11 && m00 > m22) {
+            T s = std::sqrt(one + m00 - m11 - m22) * static_cast<T>(2);
+            q = Quaternion<T>((data[9] - data[6]) / s, static_cast<T>(0.25) * s, (data[1] + data[4]) / s, (data[2] + data[8]) / s);
+        } else if (m11 > m22) {
+            T s = std::sqrt(one + m11 - m00 - m22) * static_cast<T>(2);
+            q = Quaternion<T>((data[2] - data[8]) / s, (data[1] + data[4]) / s, static_cast<T>(0.25) * s, (data[6] + data[9]) / s);
+        } else {
+            T s = std::sqrt(one + m22 - m00 - m11) * static_cast<T>(2);
+            q = Quaternion<T>((data[4] - data[1]) / s, (data[2] + data[8]) / s, (data[6] + data[9]) / s, static_cast<T>(0.25) * s);
+        }
+        return q.normalize();
+    }
+
     static Matrix4 lookAt(const Vector3<T>& eye, const Vector3<T>& center, const Vector3<T>& up) {
         Vector3<T> f = (center - eye).normalize();
         Vector3<T> s = f.cross(up).normalize();
@@ -366,6 +521,8 @@ namespace math {
         result(3, 1) = static_cast<T>(0);
         result(3, 2) = static_cast<T>(0);
         result(3, 3) = static_cast<T>(1);
+        // s, u, f ortonormal (dinormalisasi di atas)
+        result.kind = MatrixKind::RIGID;
         return result;
     }
 
@@ -384,7 +541,168 @@ namespace math {
         return result;
     }
     
+    // kernel SIMD yang dipakai operator*, transformBatch & inverse; dipilih sekali (thread-safe) saat pertama dipanggil
+    static const simd::MatrixKernels<T>& kernels() {
+        static const simd::MatrixKernels<T> selected = selectKernels();
+        return selected;
+    }
+
     private:
-        ArrayType data;
+        // toleransi |q|^2 - 1 supaya fromQuaternion masih dianggap rotasi murni
+        static constexpr T ROTATION_TOLERANCE = static_cast<T>(64) * std::numeric_limits<T>::epsilon();
+
+        alignas(32) ArrayType data;
+        MatrixKind kind = MatrixKind::PROJECTIVE;
+
+        enum UninitializedTag { UNINITIALIZED };
+        explicit Matrix4(UninitializedTag) {}
+
+        // dua-duanya baris terakhirnya (0, 0, 0, 1): cukup 3 baris, 36 perkalian
+        Matrix4 multiplyAffine(const Matrix4& other, MatrixKind resultKind) const {
+            Matrix4 result(UNINITIALIZED);
+            const T* b = other.data.data();
+            for (int i = 0; i < 3; ++i) {
+                const T* row = data.data() + i * 4;
+                for (int j = 0; j < 4; ++j) {
+                    result.data[i * 4 + j] = row[0] * b[j] + row[1] * b[4 + j] + row[2] * b[8 + j];
+                }
+                result.data[i * 4 + 3] += row[3];
+            }
+            result.data[12] = static_cast<T>(0);
+            result.data[13] = static_cast<T>(0);
+            result.data[14] = static_cast<T>(0);
+            result.data[15] = static_cast<T>(1);
+            result.kind = resultKind;
+            return result;
+        }
+
+        // R ortonormal -> R^-1 = R^T, translasi jadi -R^T t
+        Matrix4 inverseRigid() const {
+            Matrix4 result(UNINITIALIZED);
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    result.data[i * 4 + j] = data[j * 4 + i];
+                }
+            }
+            for (int i = 0; i < 3; ++i) {
+                result.data[i * 4 + 3] = -(result.data[i * 4] * data[3] + result.data[i * 4 + 1] * data[7] + result.data[i * 4 + 2] * data[11]);
+            }
+            result.data[12] = static_cast<T>(0);
+            result.data[13] = static_cast<T>(0);
+            result.data[14] = static_cast<T>(0);
+            result.data[15] = static_cast<T>(1);
+            result.kind = kind;
+            return result;
+        }
+
+        // [A | t]^-1 = [A^-1 | -A^-1 t], A^-1 lewat kofaktor 3x3
+        Matrix4 inverseAffine() const {
+            const T* m = data.data();
+            T c00 = m[5] * m[10] - m[6] * m[9];
+            T c01 = m[6] * m[8] - m[4] * m[10];
+            T c02 = m[4] * m[9] - m[5] * m[8];
+            T det = m[0] * c00 + m[1] * c01 + m[2] * c02;
+            if (det == static_cast<T>(0)) {
+                return Matrix4();
+            }
+            T invDet = static_cast<T>(1) / det;
+
+            Matrix4 result(UNINITIALIZED);
+            T* r = result.data.data();
+            r[0] = c00 * invDet;
+            r[1] = (m[2] * m[9] - m[1] * m[10]) * invDet;
+            r[2] = (m[1] * m[6] - m[2] * m[5]) * invDet;
+            r[4] = c01 * invDet;
+            r[5] = (m[0] * m[10] - m[2] * m[8]) * invDet;
+            r[6] = (m[2] * m[4] - m[0] * m[6]) * invDet;
+            r[8] = c02 * invDet;
+            r[9] = (m[1] * m[8] - m[0] * m[9]) * invDet;
+            r[10] = (m[0] * m[5] - m[1] * m[4]) * invDet;
+            for (int i = 0; i < 3; ++i) {
+                r[i * 4 + 3] = -(r[i * 4] * m[3] + r[i * 4 + 1] * m[7] + r[i * 4 + 2] * m[11]);
+            }
+            r[12] = static_cast<T>(0);
+            r[13] = static_cast<T>(0);
+            r[14] = static_cast<T>(0);
+            r[15] = static_cast<T>(1);
+            result.kind = MatrixKind::AFFINE;
+            return result;
+        }
+
+        // kandidat pertama yang hasilnya sama dengan versi skalar (dalam toleransi) yang dipakai
+        static simd::MatrixKernels<T> selectKernels() {
+            for (const auto& candidate : simd::matrixKernelCandidates<T>()) {
+                if (verifyKernels(candidate)) {
+                    return candidate;
+                }
+                std::cerr << "[Matrix4] kernel " << candidate.name << " tidak cocok dengan versi skalar, dilewati." << std::endl;
+            }
+            return simd::MatrixKernels<T>();
+        }
+
+        static bool verifyKernels(const simd::MatrixKernels<T>& candidate) {
+            const T tolerance = sizeof(T) == sizeof(float) ? static_cast<T>(1e-4) : static_cast<T>(1e-10);
+            auto close = [tolerance](T expected, T actual) {
+                return std::abs(expected - actual) <= tolerance * (static_cast<T>(1) + std::abs(expected));
+            };
+
+            // matriks pseudo-acak yang dominan diagonal (invertible & well-conditioned) + komposisi kamera beneran
+            uint32_t seed = 12345u;
+            auto next = [&seed]() {
+                seed = seed * 1664525u + 1013904223u;
+                return static_cast<T>(static_cast<int>(seed >> 8) % 2001 - 1000) / static_cast<T>(500);
+            };
+            std::array<Matrix4, 9> samples;
+            for (size_t s = 0; s < samples.size() - 1; ++s) {
+                for (int i = 0; i < 16; ++i) {
+                    samples[s].data[i] = next() + ((i % 5 == 0) ? static_cast<T>(6) : static_cast<T>(0));
+                }
+                samples[s].kind = MatrixKind::PROJECTIVE;
+            }
+            // (jangan pakai operator* di sini, kernel-nya lagi dipilih)
+            samples.back() = perspective(static_cast<T>(0.8), static_cast<T>(1.6), static_cast<T>(0.1), static_cast<T>(100))
+                                 .multiplyScalar(lookAt(Vector3<T>(1, 2, 5), Vector3<T>(0, 0, 0), Vector3<T>(0, 1, 0)));
+
+            for (size_t s = 0; s < samples.size(); ++s) {
+                const Matrix4& a = samples[s];
+                const Matrix4& b = samples[(s + 1) % samples.size()];
+
+                if (candidate.multiply) {
+                    Matrix4 expected = a.multiplyScalar(b);
+                    Matrix4 actual(UNINITIALIZED);
+                    candidate.multiply(a.data.data(), b.data.data(), actual.data.data());
+                    for (int i = 0; i < 16; ++i) {
+                        if (!close(expected.data[i], actual.data[i])) return false;
+                    }
+                }
+                if (candidate.transformVectors) {
+                    // 3 vektor: kena jalur 2-sekaligus dan sisa satu
+                    T in[12], out[12];
+                    for (T& value : in) value = next();
+                    candidate.transformVectors(a.data.data(), in, out, 3);
+                    for (int v = 0; v < 3; ++v) {
+                        Vector4<T> expected = a * Vector4<T>(in[v * 4], in[v * 4 + 1], in[v * 4 + 2], in[v * 4 + 3]);
+                        if (!close(expected.x(), out[v * 4]) || !close(expected.y(), out[v * 4 + 1]) ||
+                            !close(expected.z(), out[v * 4 + 2]) || !close(expected.w(), out[v * 4 + 3])) return false;
+                    }
+                }
+                if (candidate.inverse && s + 1 < samples.size()) {
+                    Matrix4 expected = a.inverseScalar();
+                    Matrix4 actual(UNINITIALIZED);
+                    if (!candidate.inverse(a.data.data(), actual.data.data())) return false;
+                    for (int i = 0; i < 16; ++i) {
+                        if (!close(expected.data[i], actual.data[i])) return false;
+                    }
+                }
+            }
+            if (candidate.inverse) {
+                // matriks singular harus ditolak, sama seperti versi skalar
+                Matrix4 singular;
+                singular.data.fill(static_cast<T>(1));
+                Matrix4 unused(UNINITIALIZED);
+                if (candidate.inverse(singular.data.data(), unused.data.data())) return false;
+            }
+            return true;
+        }
     };
 } // namespace math
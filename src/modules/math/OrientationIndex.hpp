@@ -0,0 +1,171 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "Quaternion.hpp"
+
+namespace math {
+    // Index nearest-neighbor buat orientasi (quaternion unit), VP-tree di atas jarak geodesik.
+    // Jarak antar rotasi = sudut rotasi R_a^T R_b = 2 * acos(|a . b|), jadi q dan -q dianggap sama persis.
+    // Di dalam tree dipakai setengahnya (sudut antar garis di S^3, 0..pi/2): metrik beneran, jadi pruning pakai
+    // ketidaksamaan segitiga valid. Dihitung lewat 2 * atan2(|a - b|, |a + b|) (b dibalik tanda kalau a . b < 0;
+    // atan2-nya sendiri baru setengah sudut garis), bukan acos, biar tetap presisi untuk orientasi yang hampir sama.
+    //
+    // Tree disimpan di satu array urut preorder: node di posisi i mencakup [i, end), anak dalam [i + 1, innerEnd)
+    // (jarak ke vantage <= threshold) dan anak luar [innerEnd, end) (>= threshold). Build O(n log n), query
+    // biasanya O(log n) buat radius kecil
+    template<typename T>
+    class OrientationIndex {
+    public:
+        struct Neighbor {
+            size_t index; // posisi di array yang dipakai build
+            T angle;      // sudut rotasi di antara keduanya (radian, 0..pi)
+        };
+
+        OrientationIndex() = default;
+        explicit OrientationIndex(const std::vector<Quaternion<T>>& orientations) { build(orientations); }
+
+        void build(const std::vector<Quaternion<T>>& orientations) {
+            std::vector<BuildItem> items(orientations.size());
+            for (size_t i = 0; i < orientations.size(); ++i) {
+                const Quaternion<T>& q = orientations[i];
+                T length = std::sqrt(q.dot(q));
+                if (!(length > static_cast<T>(0)) || !std::isfinite(length)) {
+                    throw std::invalid_argument("[OrientationIndex] orientasi ke-" + std::to_string(i) + " bukan quaternion valid.");
+                }
+                items[i].node.orientation = Quaternion<T>(q.w / length, q.x / length, q.y / length, q.z / length);
+                items[i].node.index = i;
+            }
+            uint32_t seed = 0x9E3779B9u;
+            buildRange(items, 0, items.size(), seed);
+
+            nodes.resize(items.size());
+            for (size_t i = 0; i < items.size(); ++i) nodes[i] = items[i].node;
+        }
+
+        size_t size() const { return nodes.size(); }
+        bool empty() const { return nodes.empty(); }
+
+        // sudut rotasi antara a dan b (radian, 0..pi); dua-duanya harus unit
+        static T angleBetween(const Quaternion<T>& a, const Quaternion<T>& b) {
+            return static_cast<T>(2) * lineDistance(a, b);
+        }
+
+        // k orientasi terdekat, urut dari yang paling dekat
+        std::vector<Neighbor> nearest(const Quaternion<T>& query, size_t k) const {
+            std::vector<Neighbor> result;
+            if (k == 0 || nodes.empty()) return result;
+            Quaternion<T> q = query.normalize();
+            // result dipakai sebagai max-heap berdasarkan jarak; tau = jarak kandidat terjauh sekarang
+            T tau = std::numeric_limits<T>::infinity();
+            searchNearest(0, nodes.size(), q, k, result, tau);
+            std::sort_heap(result.begin(), result.end(), closer);
+            for (Neighbor& neighbor : result) neighbor.angle *= static_cast<T>(2);
+            return result;
+        }
+
+        // semua orientasi dengan sudut rotasi <= maxAngle (radian), urut dari yang paling dekat
+        std::vector<Neighbor> withinAngle(const Quaternion<T>& query, T maxAngle) const {
+            std::vector<Neighbor> result;
+            if (nodes.empty() || maxAngle < static_cast<T>(0)) return result;
+            Quaternion<T> q = query.normalize();
+            searchRadius(0, nodes.size(), q, maxAngle / static_cast<T>(2), result);
+            std::sort(result.begin(), result.end(), closer);
+            for (Neighbor& neighbor : result) neighbor.angle *= static_cast<T>(2);
+            return result;
+        }
+
+    private:
+        struct Node {
+            Quaternion<T> orientation;
+            size_t index = 0;
+            T threshold = static_cast<T>(0);
+            size_t innerEnd = 0;
+        };
+
+        std::vector<Node> nodes;
+
+        static bool closer(const Neighbor& a, const Neighbor& b) {
+            return a.angle < b.angle;
+        }
+
+        // sudut antara garis a dan b di S^3 (0..pi/2) = acos(|a . b|). |a - b| dan |a + b| itu sisi segitiga siku-siku
+        // dengan sudut setengahnya, jadi atan2-nya dikali 2
+        static T lineDistance(const Quaternion<T>& a, const Quaternion<T>& b) {
+            T sign = a.dot(b) < static_cast<T>(0) ? static_cast<T>(-1) : static_cast<T>(1);
+            T dw = a.w - sign * b.w, dx = a.x - sign * b.x, dy = a.y - sign * b.y, dz = a.z - sign * b.z;
+            T sw = a.w + sign * b.w, sx = a.x + sign * b.x, sy = a.y + sign * b.y, sz = a.z + sign * b.z;
+            return static_cast<T>(2) * std::atan2(std::sqrt(dw * dw + dx * dx + dy * dy + dz * dz),
+                                                  std::sqrt(sw * sw + sx * sx + sy * sy + sz * sz));
+        }
+
+        // node + jarak ke vantage induknya, cuma dipakai selama build
+        struct BuildItem {
+            Node node;
+            T distance = static_cast<T>(0);
+        };
+
+        static void buildRange(std::vector<BuildItem>& items, size_t begin, size_t end, uint32_t& seed) {
+            if (end - begin <= 1) {
+                if (begin < end) items[begin].node.innerEnd = end;
+                return;
+            }
+            // vantage acak (LCG, deterministik) supaya input yang sudah terurut nggak bikin tree timpang
+            seed = seed * 1664525u + 1013904223u;
+            std::swap(items[begin], items[begin + seed % (end - begin)]);
+
+            const Quaternion<T>& vantage = items[begin].node.orientation;
+            for (size_t i = begin + 1; i < end; ++i) {
+                items[i].distance = lineDistance(vantage, items[i].node.orientation);
+            }
+            // partisi di median: yang <= median jadi anak dalam
+            size_t median = begin + 1 + (end - begin - 1) / 2;
+            std::nth_element(items.begin() + begin + 1, items.begin() + median, items.begin() + end,
+                             [](const BuildItem& a, const BuildItem& b) { return a.distance < b.distance; });
+
+            items[begin].node.threshold = items[median].distance;
+            items[begin].node.innerEnd = median + 1;
+            buildRange(items, begin + 1, median + 1, seed);
+            buildRange(items, median + 1, end, seed);
+        }
+
+        void searchNearest(size_t begin, size_t end, const Quaternion<T>& query, size_t k,
+                           std::vector<Neighbor>& heap, T& tau) const {
+            if (begin >= end) return;
+            const Node& node = nodes[begin];
+            T distance = lineDistance(query, node.orientation);
+            if (heap.size() < k || distance < tau) {
+                if (heap.size() == k) {
+                    std::pop_heap(heap.begin(), heap.end(), closer);
+                    heap.pop_back();
+                }
+                heap.push_back({node.index, distance});
+                std::push_heap(heap.begin(), heap.end(), closer);
+                if (heap.size() == k) tau = heap.front().angle;
+            }
+
+            // sisi tempat query berada dulu, sisi lain cuma kalau bola tau memotong batas threshold
+            if (distance <= node.threshold) {
+                searchNearest(begin + 1, node.innerEnd, query, k, heap, tau);
+                if (distance + tau >= node.threshold) searchNearest(node.innerEnd, end, query, k, heap, tau);
+            } else {
+                searchNearest(node.innerEnd, end, query, k, heap, tau);
+                if (distance - tau <= node.threshold) searchNearest(begin + 1, node.innerEnd, query, k, heap, tau);
+            }
+        }
+
+        void searchRadius(size_t begin, size_t end, const Quaternion<T>& query, T radius, std::vector<Neighbor>& result) const {
+            if (begin >= end) return;
+            const Node& node = nodes[begin];
+            T distance = lineDistance(query, node.orientation);
+            if (distance <= radius) result.push_back({node.index, distance});
+            if (distance - radius <= node.threshold) searchRadius(begin + 1, node.innerEnd, query, radius, result);
+            if (distance + radius >= node.threshold) searchRadius(node.innerEnd, end, query, radius, result);
+        }
+    };
+} // namespace math
@@ -0,0 +1,253 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "Vector3.hpp"
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "SimdKernels.hpp"
+
+namespace math {
+    // jumlahan pasangan titik a_i -> b_i (double), relatif ke origin masing-masing. Bisa diisi per potongan
+    // secara paralel lalu digabung pakai merge, asal origin-nya sama
+    struct AlignmentSums {
+        double originSource[3] = {0.0, 0.0, 0.0};
+        double originTarget[3] = {0.0, 0.0, 0.0};
+        double count = 0.0;
+        double values[simd::ALIGNMENT_SUM_COUNT] = {}; // layout sama dengan simd::AlignmentKernels
+
+        AlignmentSums() = default;
+        template<typename T>
+        AlignmentSums(const Vector3<T>& sourceOrigin, const Vector3<T>& targetOrigin)
+            : originSource{static_cast<double>(sourceOrigin.x), static_cast<double>(sourceOrigin.y), static_cast<double>(sourceOrigin.z)},
+              originTarget{static_cast<double>(targetOrigin.x), static_cast<double>(targetOrigin.y), static_cast<double>(targetOrigin.z)} {}
+
+        void merge(const AlignmentSums& other) {
+            count += other.count;
+            for (size_t k = 0; k < simd::ALIGNMENT_SUM_COUNT; ++k) values[k] += other.values[k];
+        }
+    };
+
+    template<typename T>
+    struct AlignmentResult {
+        Quaternion<T> rotation;   // unit, target ~ rotation * source + translation
+        Vector3<T> translation;
+        // akar rata-rata |R a + t - b|^2; dari selisih jumlahan, jadi residu di bawah ~epsilon(T) x sebaran titik
+        // (float: fit yang nyaris sempurna) cuma akurat orde besarnya
+        T rmsError = static_cast<T>(0);
+        size_t count = 0;
+        // false kalau rotasinya nggak tunggal (titik < 3, segaris, atau simetris) - rotation tetap salah satu solusi
+        bool unique = false;
+    };
+
+    // Best-fit rotasi (+ translasi) antara dua set titik berpasangan, metode quaternion Horn (1987):
+    // matriks kovariansi silang S = sum (a - mean a)(b - mean b)^T -> matriks simetris 4x4 N, quaternion optimal =
+    // vektor eigen N dengan nilai eigen terbesar (Jacobi, double). Error RMS didapat langsung dari nilai eigennya,
+    // tanpa memutar ulang semua titik.
+    //
+    // Bagian mahalnya cuma satu pass jumlahan (17 angka) per titik: kernel SIMD di atas blok BLOCK_SIZE titik dengan
+    // akumulator T, tiap blok lalu ditambahkan ke double (jadi float tetap akurat buat jutaan titik). accumulate boleh
+    // dipanggil per potongan dari banyak thread, masing-masing ke AlignmentSums sendiri
+    template<typename T>
+    class HornAligner {
+    public:
+        static constexpr size_t BLOCK_SIZE = 1024;
+
+        static void accumulate(simd::Vector3View<const T> source, simd::Vector3View<const T> target, size_t count,
+                               AlignmentSums& sums) {
+            const T origin[6] = {static_cast<T>(sums.originSource[0]), static_cast<T>(sums.originSource[1]), static_cast<T>(sums.originSource[2]),
+                                 static_cast<T>(sums.originTarget[0]), static_cast<T>(sums.originTarget[1]), static_cast<T>(sums.originTarget[2])};
+            const auto& simdKernels = kernels();
+            for (size_t begin = 0; begin < count; begin += BLOCK_SIZE) {
+                size_t blockCount = std::min(BLOCK_SIZE, count - begin);
+                simd::Vector3View<const T> blockSource{source.x + begin, source.y + begin, source.z + begin};
+                simd::Vector3View<const T> blockTarget{target.x + begin, target.y + begin, target.z + begin};
+                size_t done = 0;
+                if (simdKernels.accumulate) {
+                    T blockSums[simd::ALIGNMENT_SUM_COUNT];
+                    done = simdKernels.accumulate(blockSource, blockTarget, origin, blockCount, blockSums);
+                    for (size_t k = 0; k < simd::ALIGNMENT_SUM_COUNT; ++k) sums.values[k] += static_cast<double>(blockSums[k]);
+                }
+                accumulateScalar(blockSource, blockTarget, origin, done, blockCount, sums.values);
+                sums.count += static_cast<double>(blockCount);
+            }
+        }
+
+        static AlignmentResult<T> solve(const AlignmentSums& sums) {
+            AlignmentResult<T> result;
+            result.count = static_cast<size_t>(sums.count);
+            if (sums.count <= 0.0) return result;
+
+            const double n = sums.count;
+            const double* v = sums.values;
+            double meanA[3], meanB[3];
+            for (int r = 0; r < 3; ++r) {
+                meanA[r] = v[r] / n;
+                meanB[r] = v[3 + r] / n;
+            }
+            // kovariansi silang terpusat
+            double s[3][3];
+            for (int r = 0; r < 3; ++r) {
+                for (int c = 0; c < 3; ++c) {
+                    s[r][c] = v[6 + r * 3 + c] - n * meanA[r] * meanB[c];
+                }
+            }
+            double spreadA = std::max(0.0, v[15] - n * (meanA[0] * meanA[0] + meanA[1] * meanA[1] + meanA[2] * meanA[2]));
+            double spreadB = std::max(0.0, v[16] - n * (meanB[0] * meanB[0] + meanB[1] * meanB[1] + meanB[2] * meanB[2]));
+
+            double matrix[4][4] = {
+                {s[0][0] + s[1][1] + s[2][2], s[1][2] - s[2][1], s[2][0] - s[0][2], s[0][1] - s[1][0]},
+                {s[1][2] - s[2][1], s[0][0] - s[1][1] - s[2][2], s[0][1] + s[1][0], s[2][0] + s[0][2]},
+                {s[2][0] - s[0][2], s[0][1] + s[1][0], -s[0][0] + s[1][1] - s[2][2], s[1][2] + s[2][1]},
+                {s[0][1] - s[1][0], s[2][0] + s[0][2], s[1][2] + s[2][1], -s[0][0] - s[1][1] + s[2][2]}
+            };
+            double eigenvalues[4], eigenvectors[4][4];
+            symmetricEigen4(matrix, eigenvalues, eigenvectors);
+
+            int largest = 0, second = -1;
+            for (int k = 1; k < 4; ++k) {
+                if (eigenvalues[k] > eigenvalues[largest]) largest = k;
+            }
+            for (int k = 0; k < 4; ++k) {
+                if (k != largest && (second < 0 || eigenvalues[k] > eigenvalues[second])) second = k;
+            }
+
+            // w >= 0 biar hasilnya konsisten (q dan -q rotasi yang sama)
+            double sign = eigenvectors[0][largest] < 0.0 ? -1.0 : 1.0;
+            Quaternion<double> rotation(sign * eigenvectors[0][largest], sign * eigenvectors[1][largest],
+                                        sign * eigenvectors[2][largest], sign * eigenvectors[3][largest]);
+            rotation = rotation.normalize();
+
+            // t = pusat target - R * pusat source (pusat dalam koordinat asli)
+            Vector3<double> centroidSource(sums.originSource[0] + meanA[0], sums.originSource[1] + meanA[1], sums.originSource[2] + meanA[2]);
+            Vector3<double> centroidTarget(sums.originTarget[0] + meanB[0], sums.originTarget[1] + meanB[1], sums.originTarget[2] + meanB[2]);
+            Vector3<double> translation = centroidTarget - rotation.rotate(centroidSource);
+
+            double residual = std::max(0.0, spreadA + spreadB - 2.0 * eigenvalues[largest]);
+            const double uniqueTolerance = sizeof(T) == sizeof(float) ? 1e-6 : 1e-12;
+
+            result.rotation = Quaternion<T>(static_cast<T>(rotation.w), static_cast<T>(rotation.x), static_cast<T>(rotation.y), static_cast<T>(rotation.z));
+            result.translation = Vector3<T>(static_cast<T>(translation.x), static_cast<T>(translation.y), static_cast<T>(translation.z));
+            result.rmsError = static_cast<T>(std::sqrt(residual / n));
+            result.unique = eigenvalues[largest] - eigenvalues[second] > uniqueTolerance * (spreadA + spreadB);
+            return result;
+        }
+
+        // versi satu thread; origin diambil dari titik pertama
+        static AlignmentResult<T> align(const Vector3Array<T>& source, const Vector3Array<T>& target) {
+            if (source.size() != target.size()) {
+                throw std::invalid_argument("[HornAligner] jumlah titik source dan target tidak sama.");
+            }
+            if (source.size() == 0) return AlignmentResult<T>();
+            AlignmentSums sums(source.get(0), target.get(0));
+            accumulate(source.view(), target.view(), source.size(), sums);
+            return solve(sums);
+        }
+
+        static const simd::AlignmentKernels<T>& kernels() {
+            static const simd::AlignmentKernels<T> selected = selectKernels();
+            return selected;
+        }
+
+    private:
+        static void accumulateScalar(simd::Vector3View<const T> source, simd::Vector3View<const T> target, const T* origin,
+                                     size_t begin, size_t end, double* values) {
+            for (size_t i = begin; i < end; ++i) {
+                const double a[3] = {static_cast<double>(source.x[i] - origin[0]), static_cast<double>(source.y[i] - origin[1]),
+                                     static_cast<double>(source.z[i] - origin[2])};
+                const double b[3] = {static_cast<double>(target.x[i] - origin[3]), static_cast<double>(target.y[i] - origin[4]),
+                                     static_cast<double>(target.z[i] - origin[5])};
+                for (int r = 0; r < 3; ++r) {
+                    values[r] += a[r];
+                    values[3 + r] += b[r];
+                    for (int c = 0; c < 3; ++c) values[6 + r * 3 + c] += a[r] * b[c];
+                    values[15] += a[r] * a[r];
+                    values[16] += b[r] * b[r];
+                }
+            }
+        }
+
+        // Jacobi siklik buat matriks simetris 4x4; kolom eigenvectors[.][k] pasangan eigenvalues[k]
+        static void symmetricEigen4(double (&a)[4][4], double (&eigenvalues)[4], double (&eigenvectors)[4][4]) {
+            for (int i = 0; i < 4; ++i) {
+                for (int j = 0; j < 4; ++j) eigenvectors[i][j] = i == j ? 1.0 : 0.0;
+            }
+            for (int sweep = 0; sweep < MAX_JACOBI_SWEEPS; ++sweep) {
+                double offDiagonal = 0.0, diagonal = 0.0;
+                for (int i = 0; i < 4; ++i) {
+                    diagonal += a[i][i] * a[i][i];
+                    for (int j = i + 1; j < 4; ++j) offDiagonal += a[i][j] * a[i][j];
+                }
+                if (offDiagonal <= 1e-30 * diagonal || offDiagonal == 0.0) break;
+
+                for (int p = 0; p < 3; ++p) {
+                    for (int q = p + 1; q < 4; ++q) {
+                        if (a[p][q] == 0.0) continue;
+                        // rotasi Givens yang menolkan a[p][q] (Numerical Recipes, jacobi)
+                        double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                        double t = (theta >= 0.0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+                        double c = 1.0 / std::sqrt(t * t + 1.0);
+                        double s = t * c;
+                        for (int k = 0; k < 4; ++k) {
+                            double akp = a[k][p], akq = a[k][q];
+                            a[k][p] = c * akp - s * akq;
+                            a[k][q] = s * akp + c * akq;
+                        }
+                        for (int k = 0; k < 4; ++k) {
+                            double apk = a[p][k], aqk = a[q][k];
+                            a[p][k] = c * apk - s * aqk;
+                            a[q][k] = s * apk + c * aqk;
+                        }
+                        for (int k = 0; k < 4; ++k) {
+                            double vkp = eigenvectors[k][p], vkq = eigenvectors[k][q];
+                            eigenvectors[k][p] = c * vkp - s * vkq;
+                            eigenvectors[k][q] = s * vkp + c * vkq;
+                        }
+                    }
+                }
+            }
+            for (int i = 0; i < 4; ++i) eigenvalues[i] = a[i][i];
+        }
+
+        // biasanya konvergen (kuadratik) dalam 4-6 sweep buat 4x4
+        static constexpr int MAX_JACOBI_SWEEPS = 32;
+
+        static simd::AlignmentKernels<T> selectKernels() {
+            for (const auto& candidate : simd::alignmentKernelCandidates<T>()) {
+                if (verifyKernels(candidate)) {
+                    return candidate;
+                }
+                std::cerr << "[HornAligner] kernel " << candidate.name << " tidak cocok dengan versi skalar, dilewati." << std::endl;
+            }
+            return simd::AlignmentKernels<T>();
+        }
+
+        static bool verifyKernels(const simd::AlignmentKernels<T>& candidate) {
+            const size_t count = 37;
+            std::vector<T> values(count * 6);
+            uint32_t seed = 0x2545F491u;
+            for (T& value : values) {
+                seed = seed * 1664525u + 1013904223u;
+                value = static_cast<T>(static_cast<int>(seed >> 8) % 2001 - 1000) / static_cast<T>(250);
+            }
+            simd::Vector3View<const T> source{values.data(), values.data() + count, values.data() + count * 2};
+            simd::Vector3View<const T> target{values.data() + count * 3, values.data() + count * 4, values.data() + count * 5};
+            const T origin[6] = {static_cast<T>(0.5), static_cast<T>(-1), static_cast<T>(2), static_cast<T>(-0.25), static_cast<T>(1.5), static_cast<T>(0)};
+
+            T simdSums[simd::ALIGNMENT_SUM_COUNT];
+            size_t done = candidate.accumulate(source, target, origin, count, simdSums);
+            double expected[simd::ALIGNMENT_SUM_COUNT] = {};
+            accumulateScalar(source, target, origin, 0, done, expected);
+
+            const double tolerance = sizeof(T) == sizeof(float) ? 1e-4 : 1e-10;
+            for (size_t k = 0; k < simd::ALIGNMENT_SUM_COUNT; ++k) {
+                if (std::abs(static_cast<double>(simdSums[k]) - expected[k]) > tolerance * (1.0 + std::abs(expected[k]))) return false;
+            }
+            return true;
+        }
+    };
+} // namespace math
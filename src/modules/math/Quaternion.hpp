@@ -1,7 +1,14 @@
 #pragma once
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
 #include <stdexcept>
 #include "Vector3.hpp"
+#include "SimdKernels.hpp"
+#include "FastTrig.hpp"
 
 namespace math {
     template<typename T>
@@ -15,9 +22,9 @@ namespace math {
 
         // "cctor"
         static Quaternion fromAxisAngle(const Vector3<T>& axis, T angleRad) {
-            T halfAngle = angleRad / static_cast<T>(2);
-            T sinHalfAngle = std::sin(halfAngle);
-            return Quaternion(std::cos(halfAngle), axis.x * sinHalfAngle, axis.y * sinHalfAngle, axis.z * sinHalfAngle);
+            T sinHalfAngle, cosHalfAngle;
+            FastTrig<T>::sincos(angleRad / static_cast<T>(2), sinHalfAngle, cosHalfAngle);
+            return Quaternion(cosHalfAngle, axis.x * sinHalfAngle, axis.y * sinHalfAngle, axis.z * sinHalfAngle);
         }
 
         Quaternion conjugate() const {
@@ -37,6 +44,7 @@ namespace math {
         }
 
         // operator overloading
+        // satu perkalian tetap skalar & inline (dispatch per panggilan lebih mahal); banyak sekaligus -> multiplyBatch
         Quaternion operator*(const Quaternion& other) const {
             return Quaternion(
                 w * other.w - x * other.x - y * other.y - z * other.z,
@@ -46,11 +54,152 @@ namespace math {
             );
         }
         
-        // rotasi thd Vector3
+        // rotasi thd Vector3: q * (0, v) * q^-1 dijabarkan jadi
+        // (w^2 - u.u) v + 2 (u.v) u + 2w (u x v), u = (x, y, z); hasilnya sama persis (termasuk skala |q|^2
+        // kalau q nggak unit) tapi tanpa dua perkalian quaternion penuh
         Vector3<T> rotate(const Vector3<T>& v) const {
-            Quaternion<T> p(static_cast<T>(0), v.x, v.y, v.z);
-            Quaternion<T> rotated_p = (*this) * p * this->conjugate();
-            return Vector3<T>(rotated_p.x, rotated_p.y, rotated_p.z);
+            Vector3<T> u(x, y, z);
+            return v * (w * w - u.dot(u)) + u * (static_cast<T>(2) * u.dot(v)) + u.cross(v) * (static_cast<T>(2) * w);
+        }
+
+        T dot(const Quaternion& other) const {
+            return w * other.w + x * other.x + y * other.y + z * other.z;
+        }
+
+        // -q mewakili rotasi yang sama dengan q
+        Quaternion negate() const {
+            return Quaternion(-w, -x, -y, -z);
+        }
+
+        // log quaternion unit: (0, sumbu * setengah sudut)
+        Quaternion log() const {
+            T vectorLength = std::sqrt(x * x + y * y + z * z);
+            if (vectorLength < std::numeric_limits<T>::epsilon()) {
+                return Quaternion(static_cast<T>(0), x, y, z);
+            }
+            T scale = std::atan2(vectorLength, w) / vectorLength;
+            return Quaternion(static_cast<T>(0), x * scale, y * scale, z * scale);
+        }
+
+        // exp quaternion murni (w diabaikan), kebalikan log()
+        Quaternion exp() const {
+            T angle = std::sqrt(x * x + y * y + z * z);
+            if (angle < std::numeric_limits<T>::epsilon()) {
+                return Quaternion(static_cast<T>(1), x, y, z);
+            }
+            T scale = std::sin(angle) / angle;
+            return Quaternion(std::cos(angle), x * scale, y * scale, z * scale);
+        }
+
+        // interpolasi linear lalu dinormalisasi: murah, kecepatan sudutnya nggak konstan
+        static Quaternion nlerp(const Quaternion& a, const Quaternion& b, T t) {
+            Quaternion target = a.dot(b) < static_cast<T>(0) ? b.negate() : b;
+            return Quaternion(
+                a.w + (target.w - a.w) * t,
+                a.x + (target.x - a.x) * t,
+                a.y + (target.y - a.y) * t,
+                a.z + (target.z - a.z) * t
+            ).normalize();
+        }
+
+        // interpolasi di permukaan S^3 dengan kecepatan sudut konstan, lewat jalur terpendek
+        static Quaternion slerp(const Quaternion& a, const Quaternion& b, T t) {
+            Quaternion target = a.dot(b) < static_cast<T>(0) ? b.negate() : b;
+            return slerpNoFlip(a, target, t);
+        }
+
+        // slerp tanpa milih jalur terpendek (squad butuh ini supaya kurvanya kontinu)
+        static Quaternion slerpNoFlip(const Quaternion& a, const Quaternion& b, T t) {
+            T cosOmega = a.dot(b);
+            // hampir sejajar: sin(omega) ~ 0, nlerp sudah cukup akurat
+            if (std::abs(cosOmega) > static_cast<T>(1) - SLERP_EPSILON) {
+                return Quaternion(
+                    a.w + (b.w - a.w) * t,
+                    a.x + (b.x - a.x) * t,
+                    a.y + (b.y - a.y) * t,
+                    a.z + (b.z - a.z) * t
+                ).normalize();
+            }
+            T omega = std::acos(std::max(static_cast<T>(-1), std::min(static_cast<T>(1), cosOmega)));
+            T invSinOmega = static_cast<T>(1) / std::sin(omega);
+            return blend(a, b, std::sin((static_cast<T>(1) - t) * omega) * invSinOmega, std::sin(t * omega) * invSinOmega);
+        }
+
+        // spherical quadrangle: kurva C1 lewat q1 -> q2 dengan titik kontrol s1, s2 (lihat squadControlPoint)
+        static Quaternion squad(const Quaternion& q1, const Quaternion& q2, const Quaternion& s1, const Quaternion& s2, T t) {
+            return slerpNoFlip(slerpNoFlip(q1, q2, t), slerpNoFlip(s1, s2, t),
+                               static_cast<T>(2) * t * (static_cast<T>(1) - t));
+        }
+
+        // s_i = q_i * exp(-(log(q_i^-1 q_{i+1}) + log(q_i^-1 q_{i-1})) / 4), semua unit & sudah satu hemisfer
+        static Quaternion squadControlPoint(const Quaternion& previous, const Quaternion& current, const Quaternion& next) {
+            Quaternion inverse = current.conjugate();
+            Quaternion a = (inverse * next).log();
+            Quaternion b = (inverse * previous).log();
+            T scale = static_cast<T>(-0.25);
+            return current * Quaternion(static_cast<T>(0), (a.x + b.x) * scale, (a.y + b.y) * scale, (a.z + b.z) * scale).exp();
+        }
+
+        // a * weightA + b * weightB
+        static Quaternion blend(const Quaternion& a, const Quaternion& b, T weightA, T weightB) {
+            return Quaternion(
+                a.w * weightA + b.w * weightB,
+                a.x * weightA + b.x * weightB,
+                a.y * weightA + b.y * weightB,
+                a.z * weightA + b.z * weightB
+            );
+        }
+
+        // out[i] = a[i] * b[i]; out boleh sama dengan a atau b
+        static void multiplyBatch(const Quaternion* a, const Quaternion* b, Quaternion* out, size_t count) {
+            static_assert(sizeof(Quaternion) == 4 * sizeof(T), "Quaternion harus 4 komponen rapat");
+            const auto& simdKernels = kernels();
+            if (simdKernels.multiplyBatch) {
+                simdKernels.multiplyBatch(reinterpret_cast<const T*>(a), reinterpret_cast<const T*>(b),
+                                          reinterpret_cast<T*>(out), count);
+                return;
+            }
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = a[i] * b[i];
+            }
+        }
+
+        static const simd::QuaternionKernels<T>& kernels() {
+            static const simd::QuaternionKernels<T> selected = selectKernels();
+            return selected;
+        }
+
+    private:
+        static constexpr T SLERP_EPSILON = static_cast<T>(1e-5);
+
+        static simd::QuaternionKernels<T> selectKernels() {
+            for (const auto& candidate : simd::quaternionKernelCandidates<T>()) {
+                bool matches = true;
+                uint32_t seed = 777u;
+                auto next = [&seed]() {
+                    seed = seed * 1664525u + 1013904223u;
+                    return static_cast<T>(static_cast<int>(seed >> 8) % 2001 - 1000) / static_cast<T>(1000);
+                };
+                Quaternion a[8], b[8], out[8];
+                for (int s = 0; s < 8; ++s) {
+                    a[s] = Quaternion(next(), next(), next(), next());
+                    b[s] = Quaternion(next(), next(), next(), next());
+                }
+                candidate.multiplyBatch(&a[0].w, &b[0].w, &out[0].w, 8);
+                for (int s = 0; s < 8; ++s) {
+                    Quaternion expected = a[s] * b[s];
+                    T e[4] = {expected.w, expected.x, expected.y, expected.z};
+                    T o[4] = {out[s].w, out[s].x, out[s].y, out[s].z};
+                    for (int i = 0; i < 4; ++i) {
+                        matches = matches && std::abs(e[i] - o[i]) <= static_cast<T>(1e-5) * (static_cast<T>(1) + std::abs(e[i]));
+                    }
+                }
+                if (matches) {
+                    return candidate;
+                }
+                std::cerr << "[Quaternion] kernel " << candidate.name << " tidak cocok dengan versi skalar, dilewati." << std::endl;
+            }
+            return simd::QuaternionKernels<T>();
         }
     };
 } // namespace math
@@ -0,0 +1,238 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "Vector3.hpp"
+#include "Quaternion.hpp"
+#include "Matrix4.hpp"
+#include "SimdKernels.hpp"
+
+namespace math {
+    // array Vector3 format SoA (x semua, y semua, z semua) buat operasi batch
+    template<typename T>
+    struct Vector3Array {
+        std::vector<T> x, y, z;
+
+        Vector3Array() = default;
+        explicit Vector3Array(const std::vector<Vector3<T>>& vectors) {
+            assign(vectors);
+        }
+
+        size_t size() const { return x.size(); }
+        void resize(size_t count) {
+            x.resize(count);
+            y.resize(count);
+            z.resize(count);
+        }
+
+        Vector3<T> get(size_t index) const { return Vector3<T>(x[index], y[index], z[index]); }
+        void set(size_t index, const Vector3<T>& v) {
+            x[index] = v.x;
+            y[index] = v.y;
+            z[index] = v.z;
+        }
+
+        void assign(const std::vector<Vector3<T>>& vectors) {
+            resize(vectors.size());
+            for (size_t i = 0; i < vectors.size(); ++i) {
+                set(i, vectors[i]);
+            }
+        }
+        void copyTo(std::vector<Vector3<T>>& vectors) const {
+            vectors.resize(size());
+            for (size_t i = 0; i < size(); ++i) {
+                vectors[i] = get(i);
+            }
+        }
+
+        simd::Vector3View<const T> view() const { return {x.data(), y.data(), z.data()}; }
+        simd::Vector3View<T> view() { return {x.data(), y.data(), z.data()}; }
+    };
+
+    template<typename T>
+    struct QuaternionArray {
+        std::vector<T> w, x, y, z;
+
+        size_t size() const { return w.size(); }
+        void resize(size_t count) {
+            w.resize(count, static_cast<T>(1));
+            x.resize(count);
+            y.resize(count);
+            z.resize(count);
+        }
+
+        Quaternion<T> get(size_t index) const { return Quaternion<T>(w[index], x[index], y[index], z[index]); }
+        void set(size_t index, const Quaternion<T>& q) {
+            w[index] = q.w;
+            x[index] = q.x;
+            y[index] = q.y;
+            z[index] = q.z;
+        }
+        void push_back(const Quaternion<T>& q) {
+            w.push_back(q.w);
+            x.push_back(q.x);
+            y.push_back(q.y);
+            z.push_back(q.z);
+        }
+
+        simd::QuaternionView<const T> view() const { return {w.data(), x.data(), y.data(), z.data()}; }
+        simd::QuaternionView<T> view() { return {w.data(), x.data(), y.data(), z.data()}; }
+    };
+
+    // Operasi quaternion ke banyak data sekaligus. Rotasi pakai bentuk v + w t + u x t (t = 2 u x v),
+    // jadi quaternion harus unit; hasilnya sama dengan Quaternion::rotate buat quaternion unit.
+    // Kernel SIMD dipilih sekali saat runtime dan dicek dulu terhadap versi skalar di bawah (sama seperti Matrix4).
+    // out boleh objek yang sama dengan in
+    template<typename T>
+    class QuaternionBatch {
+    public:
+        // satu rotasi buat semua vektor; q dinormalisasi dulu (sekali)
+        static void rotate(const Quaternion<T>& q, const Vector3Array<T>& in, Vector3Array<T>& out) {
+            Quaternion<T> unit = q.normalize();
+            const T components[4] = {unit.w, unit.x, unit.y, unit.z};
+            out.resize(in.size());
+            size_t done = kernels().rotate ? kernels().rotate(components, in.view(), out.view(), in.size()) : 0;
+            rotateScalar(components, in.view(), out.view(), done, in.size());
+        }
+
+        // vektor ke-i diputar quaternion ke-i (quaternion harus sudah unit, lihat normalize)
+        static void rotate(const QuaternionArray<T>& rotations, const Vector3Array<T>& in, Vector3Array<T>& out) {
+            if (rotations.size() != in.size()) {
+                throw std::invalid_argument("[QuaternionBatch] jumlah quaternion dan vektor tidak sama.");
+            }
+            out.resize(in.size());
+            size_t done = kernels().rotateEach ? kernels().rotateEach(rotations.view(), in.view(), out.view(), in.size()) : 0;
+            rotateEachScalar(rotations.view(), in.view(), out.view(), done, in.size());
+        }
+
+        // in-place; quaternion nol jadi identitas (sama seperti Quaternion::normalize)
+        static void normalize(QuaternionArray<T>& rotations) {
+            size_t done = kernels().normalize ? kernels().normalize(rotations.view(), rotations.size()) : 0;
+            normalizeScalar(rotations.view(), done, rotations.size());
+        }
+
+        // hasilnya Matrix4 (AoS) yang memang dipakai renderer, jadi ini loop biasa: penulisan 16 elemen per
+        // matriks yang dominan, transpose SoA -> AoS pakai SIMD nggak bikin lebih cepat
+        static void toMatrices(const QuaternionArray<T>& rotations, std::vector<Matrix4<T>>& out) {
+            out.resize(rotations.size());
+            for (size_t i = 0; i < rotations.size(); ++i) {
+                out[i] = Matrix4<T>::fromQuaternion(rotations.get(i));
+            }
+        }
+
+        static const simd::QuaternionBatchKernels<T>& kernels() {
+            static const simd::QuaternionBatchKernels<T> selected = selectKernels();
+            return selected;
+        }
+
+        // versi referensi (juga dipakai buat sisa elemen yang bukan kelipatan lebar register)
+        static void rotateScalar(const T* q, simd::Vector3View<const T> in, simd::Vector3View<T> out, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                rotateOne(q[0], q[1], q[2], q[3], in.x[i], in.y[i], in.z[i], out.x[i], out.y[i], out.z[i]);
+            }
+        }
+        static void rotateEachScalar(simd::QuaternionView<const T> q, simd::Vector3View<const T> in, simd::Vector3View<T> out,
+                                     size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                rotateOne(q.w[i], q.x[i], q.y[i], q.z[i], in.x[i], in.y[i], in.z[i], out.x[i], out.y[i], out.z[i]);
+            }
+        }
+        static void normalizeScalar(simd::QuaternionView<T> q, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                Quaternion<T> unit = Quaternion<T>(q.w[i], q.x[i], q.y[i], q.z[i]).normalize();
+                q.w[i] = unit.w;
+                q.x[i] = unit.x;
+                q.y[i] = unit.y;
+                q.z[i] = unit.z;
+            }
+        }
+
+    private:
+        static void rotateOne(T w, T ux, T uy, T uz, T vx, T vy, T vz, T& rx, T& ry, T& rz) {
+            T tx = static_cast<T>(2) * (uy * vz - uz * vy);
+            T ty = static_cast<T>(2) * (uz * vx - ux * vz);
+            T tz = static_cast<T>(2) * (ux * vy - uy * vx);
+            rx = vx + w * tx + (uy * tz - uz * ty);
+            ry = vy + w * ty + (uz * tx - ux * tz);
+            rz = vz + w * tz + (ux * ty - uy * tx);
+        }
+
+        static simd::QuaternionBatchKernels<T> selectKernels() {
+            for (const auto& candidate : simd::quaternionBatchKernelCandidates<T>()) {
+                if (verifyKernels(candidate)) {
+                    return candidate;
+                }
+                std::cerr << "[QuaternionBatch] kernel " << candidate.name << " tidak cocok dengan versi skalar, dilewati." << std::endl;
+            }
+            return simd::QuaternionBatchKernels<T>();
+        }
+
+        static bool verifyKernels(const simd::QuaternionBatchKernels<T>& candidate) {
+            const T tolerance = sizeof(T) == sizeof(float) ? static_cast<T>(1e-5) : static_cast<T>(1e-12);
+            auto close = [tolerance](T expected, T actual) {
+                return std::abs(expected - actual) <= tolerance * (static_cast<T>(1) + std::abs(expected));
+            };
+
+            // 16 elemen: cukup buat dua iterasi AVX float; kernel boleh berhenti sebelum akhir (sisanya skalar)
+            const size_t count = 16;
+            uint32_t seed = 4242u;
+            auto next = [&seed]() {
+                seed = seed * 1664525u + 1013904223u;
+                return static_cast<T>(static_cast<int>(seed >> 8) % 2001 - 1000) / static_cast<T>(250);
+            };
+            QuaternionArray<T> rotations;
+            Vector3Array<T> in;
+            in.resize(count);
+            for (size_t i = 0; i < count; ++i) {
+                // satu quaternion nol buat ngetes kasus identitas di normalize
+                rotations.push_back(i == 5 ? Quaternion<T>(0, 0, 0, 0) : Quaternion<T>(next(), next(), next(), next()));
+                in.set(i, Vector3<T>(next(), next(), next()));
+            }
+
+            if (candidate.normalize) {
+                QuaternionArray<T> expected = rotations;
+                normalizeScalar(expected.view(), 0, count);
+                size_t done = candidate.normalize(rotations.view(), count);
+                normalizeScalar(rotations.view(), done, count);
+                for (size_t i = 0; i < count; ++i) {
+                    if (!close(expected.w[i], rotations.w[i]) || !close(expected.x[i], rotations.x[i]) ||
+                        !close(expected.y[i], rotations.y[i]) || !close(expected.z[i], rotations.z[i])) return false;
+                }
+            } else {
+                normalizeScalar(rotations.view(), 0, count);
+            }
+
+            auto sameVectors = [&close](const Vector3Array<T>& a, const Vector3Array<T>& b) {
+                for (size_t i = 0; i < a.size(); ++i) {
+                    if (!close(a.x[i], b.x[i]) || !close(a.y[i], b.y[i]) || !close(a.z[i], b.z[i])) return false;
+                }
+                return true;
+            };
+            if (candidate.rotate) {
+                Quaternion<T> q = rotations.get(3);
+                const T components[4] = {q.w, q.x, q.y, q.z};
+                Vector3Array<T> expected, actual;
+                expected.resize(count);
+                actual.resize(count);
+                rotateScalar(components, std::as_const(in).view(), expected.view(), 0, count);
+                size_t done = candidate.rotate(components, std::as_const(in).view(), actual.view(), count);
+                rotateScalar(components, std::as_const(in).view(), actual.view(), done, count);
+                if (!sameVectors(expected, actual)) return false;
+            }
+            if (candidate.rotateEach) {
+                Vector3Array<T> expected, actual;
+                expected.resize(count);
+                actual.resize(count);
+                rotateEachScalar(std::as_const(rotations).view(), std::as_const(in).view(), expected.view(), 0, count);
+                size_t done = candidate.rotateEach(std::as_const(rotations).view(), std::as_const(in).view(), actual.view(), count);
+                rotateEachScalar(std::as_const(rotations).view(), std::as_const(in).view(), actual.view(), done, count);
+                if (!sameVectors(expected, actual)) return false;
+            }
+            return true;
+        }
+    };
+} // namespace math
@@ -0,0 +1,162 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include "Quaternion.hpp"
+#include "Matrix4.hpp"
+
+namespace math {
+    // cara mengembalikan rotasi hasil komposisi panjang ke bentuk unit/ortonormal lagi.
+    // Quaternion: NORMALIZE, FAST_NORMALIZE. Matrix4: GRAM_SCHMIDT, FAST_ORTHONORMALIZE, VIA_QUATERNION.
+    // Metode yang nggak berlaku buat representasinya = NONE
+    enum class RenormalizeMethod {
+        NONE = 0,
+        NORMALIZE = 1,           // q / |q| (sqrt + bagi)
+        FAST_NORMALIZE = 2,      // q * (3 - |q|^2) / 2: satu langkah Newton 1/sqrt, tanpa sqrt; butuh |q| ~ 1
+        GRAM_SCHMIDT = 3,        // kolom 0 dinormalisasi, kolom 1 & 2 diproyeksikan ulang (bias ke kolom 0)
+        FAST_ORTHONORMALIZE = 4, // R * (3I - R^T R) / 2: satu langkah iterasi polar (Bjorck), simetris antar kolom
+        VIA_QUATERNION = 5       // R -> quaternion (Shepperd) -> R
+    };
+
+    inline const char* renormalizeMethodName(RenormalizeMethod method) {
+        switch (method) {
+            case RenormalizeMethod::NORMALIZE: return "normalize";
+            case RenormalizeMethod::FAST_NORMALIZE: return "fast-normalize";
+            case RenormalizeMethod::GRAM_SCHMIDT: return "gram-schmidt";
+            case RenormalizeMethod::FAST_ORTHONORMALIZE: return "fast-orthonormalize";
+            case RenormalizeMethod::VIA_QUATERNION: return "via-quaternion";
+            default: return "none";
+        }
+    }
+
+    // semua fungsi cuma menyentuh bagian rotasi; translasi Matrix4 dibiarkan
+    template<typename T>
+    class Renormalization {
+    public:
+        static Quaternion<T> fastNormalize(const Quaternion<T>& q) {
+            T factor = (static_cast<T>(3) - q.dot(q)) / static_cast<T>(2);
+            return Quaternion<T>(q.w * factor, q.x * factor, q.y * factor, q.z * factor);
+        }
+
+        static Matrix4<T> gramSchmidt(const Matrix4<T>& m) {
+            T c[3][3];
+            readColumns(m, c);
+            normalizeColumn(c[0]);
+            subtractProjection(c[1], c[0]);
+            normalizeColumn(c[1]);
+            // kolom ketiga langsung dari cross product: ortogonal & tangan kanan tanpa proyeksi lagi
+            c[2][0] = c[0][1] * c[1][2] - c[0][2] * c[1][1];
+            c[2][1] = c[0][2] * c[1][0] - c[0][0] * c[1][2];
+            c[2][2] = c[0][0] * c[1][1] - c[0][1] * c[1][0];
+            return writeColumns(m, c);
+        }
+
+        static Matrix4<T> fastOrthonormalize(const Matrix4<T>& m) {
+            T c[3][3];
+            readColumns(m, c);
+            // R' = R * (3I - G) / 2, G = R^T R (Gram matrix kolom)
+            T g[3][3];
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    g[i][j] = c[i][0] * c[j][0] + c[i][1] * c[j][1] + c[i][2] * c[j][2];
+                }
+            }
+            T result[3][3];
+            for (int j = 0; j < 3; ++j) {
+                for (int row = 0; row < 3; ++row) {
+                    T sum = static_cast<T>(0);
+                    for (int k = 0; k < 3; ++k) {
+                        T factor = (k == j ? static_cast<T>(3) : static_cast<T>(0)) - g[k][j];
+                        sum += c[k][row] * factor;
+                    }
+                    result[j][row] = sum / static_cast<T>(2);
+                }
+            }
+            return writeColumns(m, result);
+        }
+
+        static Matrix4<T> viaQuaternion(const Matrix4<T>& m) {
+            Matrix4<T> rotation = Matrix4<T>::fromQuaternion(m.toQuaternion());
+            T c[3][3];
+            readColumns(rotation, c);
+            return writeColumns(m, c);
+        }
+
+        static Quaternion<T> apply(RenormalizeMethod method, const Quaternion<T>& q) {
+            switch (method) {
+                case RenormalizeMethod::NORMALIZE: return q.normalize();
+                case RenormalizeMethod::FAST_NORMALIZE: return fastNormalize(q);
+                default: return q;
+            }
+        }
+
+        static Matrix4<T> apply(RenormalizeMethod method, const Matrix4<T>& m) {
+            switch (method) {
+                case RenormalizeMethod::GRAM_SCHMIDT: return gramSchmidt(m);
+                case RenormalizeMethod::FAST_ORTHONORMALIZE: return fastOrthonormalize(m);
+                case RenormalizeMethod::VIA_QUATERNION: return viaQuaternion(m);
+                default: return m;
+            }
+        }
+
+        // | |q|^2 - 1 |
+        static T normError(const Quaternion<T>& q) {
+            return std::abs(q.dot(q) - static_cast<T>(1));
+        }
+
+        // max |R^T R - I| (3x3 kiri atas)
+        static T orthogonalityError(const Matrix4<T>& m) {
+            T c[3][3];
+            readColumns(m, c);
+            T worst = static_cast<T>(0);
+            for (int i = 0; i < 3; ++i) {
+                for (int j = i; j < 3; ++j) {
+                    T dot = c[i][0] * c[j][0] + c[i][1] * c[j][1] + c[i][2] * c[j][2];
+                    worst = std::max(worst, std::abs(dot - (i == j ? static_cast<T>(1) : static_cast<T>(0))));
+                }
+            }
+            return worst;
+        }
+
+    private:
+        // c[kolom][baris]
+        static void readColumns(const Matrix4<T>& m, T (&c)[3][3]) {
+            for (int col = 0; col < 3; ++col) {
+                for (int row = 0; row < 3; ++row) {
+                    c[col][row] = m(row, col);
+                }
+            }
+        }
+
+        // translasi & baris terakhir diambil dari m; 3x3-nya sekarang ortonormal jadi affine pun turun ke rigid
+        static Matrix4<T> writeColumns(const Matrix4<T>& m, const T (&c)[3][3]) {
+            typename Matrix4<T>::ArrayType data = m.getData();
+            for (int col = 0; col < 3; ++col) {
+                for (int row = 0; row < 3; ++row) {
+                    data[row * 4 + col] = c[col][row];
+                }
+            }
+            Matrix4<T> result(data);
+            MatrixKind kind = m.getKind();
+            result.setKind(kind <= MatrixKind::ROTATION ? MatrixKind::ROTATION
+                           : kind <= MatrixKind::AFFINE ? MatrixKind::RIGID : MatrixKind::PROJECTIVE);
+            return result;
+        }
+
+        static void normalizeColumn(T (&v)[3]) {
+            T length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+            if (length == static_cast<T>(0)) return;
+            v[0] /= length;
+            v[1] /= length;
+            v[2] /= length;
+        }
+
+        // v -= (v . unit) unit
+        static void subtractProjection(T (&v)[3], const T (&unit)[3]) {
+            T dot = v[0] * unit[0] + v[1] * unit[1] + v[2] * unit[2];
+            v[0] -= dot * unit[0];
+            v[1] -= dot * unit[1];
+            v[2] -= dot * unit[2];
+        }
+    };
+} // namespace math
@@ -0,0 +1,429 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "Vector3.hpp"
+#include "Matrix4.hpp"
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "FastTrig.hpp"
+
+namespace math {
+    // 6 urutan Tait-Bryan (tiga sumbu beda) + 6 urutan Euler klasik (sumbu pertama = ketiga)
+    enum class AxisOrder {
+        XYZ = 0, XZY = 1, YXZ = 2, YZX = 3, ZXY = 4, ZYX = 5,
+        XYX = 6, XZX = 7, YXY = 8, YZY = 9, ZXZ = 10, ZYZ = 11
+    };
+    static constexpr int AXIS_ORDER_COUNT = 12;
+
+    // INTRINSIC "ZYX" (a, b, c): putar a di Z, lalu b di Y baru, lalu c di X baru -> R = Rz(a) * Ry(b) * Rx(c)
+    // (sama dengan EulerAngles::fromZYX & TaitBryanAngles). EXTRINSIC "ZYX": putar di sumbu dunia Z, Y, X
+    // berurutan -> R = Rx(c) * Ry(b) * Rz(a), jadi sama dengan INTRINSIC "XYZ" (c, b, a)
+    enum class RotationFrame {
+        INTRINSIC = 0,
+        EXTRINSIC = 1
+    };
+
+    namespace detail {
+        // sumbu 0 = x, 1 = y, 2 = z
+        struct AxisSequence {
+            int first, second, third;
+        };
+
+        inline AxisSequence axisSequence(AxisOrder order) {
+            static const AxisSequence table[AXIS_ORDER_COUNT] = {
+                {0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0},
+                {0, 1, 0}, {0, 2, 0}, {1, 0, 1}, {1, 2, 1}, {2, 0, 2}, {2, 1, 2}
+            };
+            return table[static_cast<int>(order)];
+        }
+
+        inline const char* axisOrderName(AxisOrder order) {
+            static const char* names[AXIS_ORDER_COUNT] = {
+                "XYZ", "XZY", "YXZ", "YZX", "ZXY", "ZYX", "XYX", "XZX", "YXY", "YZY", "ZXZ", "ZYZ"
+            };
+            return names[static_cast<int>(order)];
+        }
+
+        // sumbu yang nggak dipakai sumbu i & j (i != j), dan tanda e_i x e_j = parity * e_m
+        inline int remainingAxis(int i, int j) { return 3 - i - j; }
+        inline int axisParity(int i, int j) { return (j - i + 3) % 3 == 1 ? 1 : -1; }
+
+        // v <- R_axis(angle) * v, dari sin/cos sudutnya
+        template<typename T>
+        void rotateAboutAxis(int axis, T s, T c, T* v) {
+            int b = (axis + 1) % 3, d = (axis + 2) % 3;
+            T vb = v[b], vd = v[d];
+            v[b] = c * vb - s * vd;
+            v[d] = s * vb + c * vd;
+        }
+
+        // q <- q * (c + s e_axis) (q = w + v, quaternion elementer dari setengah sudut).
+        // Sumbu compile-time supaya loop batch tetap ke-inline & divektorisasi
+        template<int AXIS, typename T>
+        inline void multiplyAxis(T s, T c, T& w, T* v) {
+            constexpr int b = (AXIS + 1) % 3, d = (AXIS + 2) % 3;
+            T wOld = w, va = v[AXIS], vb = v[b], vd = v[d];
+            w = wOld * c - va * s;
+            v[AXIS] = va * c + wOld * s;
+            v[b] = vb * c + vd * s;
+            v[d] = vd * c - vb * s;
+        }
+
+        template<typename T>
+        void multiplyAxis(int axis, T s, T c, T& w, T* v) {
+            switch (axis) {
+            case 0: multiplyAxis<0>(s, c, w, v); break;
+            case 1: multiplyAxis<1>(s, c, w, v); break;
+            default: multiplyAxis<2>(s, c, w, v); break;
+            }
+        }
+
+        // R_i(a) * R_j(b) * R_k(c) dari sin/cos sudut penuh
+        template<typename T>
+        Matrix4<T> axisOrderMatrix(const AxisSequence& axes, const T* s, const T* c) {
+            typename Matrix4<T>::ArrayType data{};
+            for (int column = 0; column < 3; ++column) {
+                T v[3] = {0, 0, 0};
+                v[column] = static_cast<T>(1);
+                rotateAboutAxis(axes.third, s[2], c[2], v);
+                rotateAboutAxis(axes.second, s[1], c[1], v);
+                rotateAboutAxis(axes.first, s[0], c[0], v);
+                for (int row = 0; row < 3; ++row) data[row * 4 + column] = v[row];
+            }
+            data[15] = static_cast<T>(1);
+            Matrix4<T> result(data);
+            result.setKind(MatrixKind::ROTATION);
+            return result;
+        }
+
+        // q_i(a) * q_j(b) * q_k(c) dari sin/cos SETENGAH sudut, tanpa lewat matriks
+        template<typename T>
+        Quaternion<T> axisOrderQuaternion(const AxisSequence& axes, const T* s, const T* c) {
+            T w = c[0];
+            T v[3] = {0, 0, 0};
+            v[axes.first] = s[0];
+            multiplyAxis(axes.second, s[1], c[1], w, v);
+            multiplyAxis(axes.third, s[2], c[2], w, v);
+            return Quaternion<T>(w, v[0], v[1], v[2]);
+        }
+
+        // urutan intrinsic dengan sumbu compile-time, buat loop batch yang bisa divektorisasi compiler.
+        // f dipanggil dengan tiga std::integral_constant<int, ...>
+        template<typename F>
+        void dispatchAxisSequence(const AxisSequence& axes, F&& f) {
+            using X = std::integral_constant<int, 0>;
+            using Y = std::integral_constant<int, 1>;
+            using Z = std::integral_constant<int, 2>;
+            int code = axes.first * 9 + axes.second * 3 + axes.third;
+            switch (code) {
+            case 0 * 9 + 1 * 3 + 2: f(X(), Y(), Z()); break;
+            case 0 * 9 + 2 * 3 + 1: f(X(), Z(), Y()); break;
+            case 1 * 9 + 0 * 3 + 2: f(Y(), X(), Z()); break;
+            case 1 * 9 + 2 * 3 + 0: f(Y(), Z(), X()); break;
+            case 2 * 9 + 0 * 3 + 1: f(Z(), X(), Y()); break;
+            case 2 * 9 + 1 * 3 + 0: f(Z(), Y(), X()); break;
+            case 0 * 9 + 1 * 3 + 0: f(X(), Y(), X()); break;
+            case 0 * 9 + 2 * 3 + 0: f(X(), Z(), X()); break;
+            case 1 * 9 + 0 * 3 + 1: f(Y(), X(), Y()); break;
+            case 1 * 9 + 2 * 3 + 1: f(Y(), Z(), Y()); break;
+            case 2 * 9 + 0 * 3 + 2: f(Z(), X(), Z()); break;
+            case 2 * 9 + 1 * 3 + 2: f(Z(), Y(), Z()); break;
+            default: break;
+            }
+        }
+    } // namespace detail
+
+    // Konversi antara sudut (semua 12 urutan, intrinsic/extrinsic), quaternion, dan matriks rotasi.
+    // Sudut dalam derajat, Vector3 = (sudut pertama, kedua, ketiga) sesuai urutan. Hasil balik (dari quaternion/
+    // matriks) ada di rentang (-180, 180]; sudut tengah di [-90, 90] (Tait-Bryan) atau [0, 180] (Euler klasik).
+    // Di gimbal lock sudut ketiga dibikin 0 dan seluruh putarannya masuk ke sudut pertama.
+    //
+    // Sudut -> quaternion langsung dari setengah sudut (tiga quaternion elementer dikalikan, ~20 flop).
+    // Quaternion -> sudut langsung lewat dua atan2 setengah sudut (Bernardes & Viollet 2022): Tait-Bryan dulu
+    // diputar 90 derajat di sumbu tengah supaya jadi bentuk Euler klasik. Versi batch (Vector3Array/QuaternionArray)
+    // memakai FastTrig batch (sincos/atan2 SIMD) per potongan dan loop dengan sumbu compile-time
+    template<typename T>
+    class RotationConversion {
+    public:
+        // buffer per potongan ada di stack (~9 * CHUNK_SIZE * sizeof(T) per fungsi)
+        static constexpr size_t CHUNK_SIZE = 256;
+
+        static Quaternion<T> anglesToQuaternion(const Vector3<T>& angles, AxisOrder order,
+                                                RotationFrame frame = RotationFrame::INTRINSIC) {
+            detail::AxisSequence axes;
+            T a[3];
+            toIntrinsic(angles, order, frame, axes, a);
+            T s[3], c[3];
+            const T factor = FastTrig<T>::DEGREES_TO_RADIANS * static_cast<T>(0.5);
+            for (int n = 0; n < 3; ++n) FastTrig<T>::sincos(a[n] * factor, s[n], c[n]);
+            return detail::axisOrderQuaternion(axes, s, c);
+        }
+
+        static Matrix4<T> anglesToMatrix(const Vector3<T>& angles, AxisOrder order,
+                                         RotationFrame frame = RotationFrame::INTRINSIC) {
+            detail::AxisSequence axes;
+            T a[3];
+            toIntrinsic(angles, order, frame, axes, a);
+            T s[3], c[3];
+            for (int n = 0; n < 3; ++n) FastTrig<T>::sincos(a[n] * FastTrig<T>::DEGREES_TO_RADIANS, s[n], c[n]);
+            return detail::axisOrderMatrix(axes, s, c);
+        }
+
+        // q boleh belum dinormalisasi (asal bukan nol)
+        static Vector3<T> quaternionToAngles(const Quaternion<T>& q, AxisOrder order,
+                                             RotationFrame frame = RotationFrame::INTRINSIC) {
+            detail::AxisSequence axes = intrinsicSequence(order, frame);
+            T components[4] = {};
+            halfAngleComponents(axes, q.w, q.x, q.y, q.z, components);
+
+            T sumHalf = FastTrig<T>::atan2(components[1], components[0]);
+            T differenceHalf = FastTrig<T>::atan2(components[3], components[2]);
+            T cosineHalf = std::sqrt(components[0] * components[0] + components[1] * components[1]);
+            T sineHalf = std::sqrt(components[2] * components[2] + components[3] * components[3]);
+            T middleHalf = FastTrig<T>::atan2(sineHalf, cosineHalf);
+
+            T a[3];
+            combineHalfAngles(axes.third != axes.first, static_cast<T>(detail::axisParity(axes.first, axes.second)),
+                              sumHalf, differenceHalf, middleHalf, sineHalf, cosineHalf, a);
+            return fromIntrinsic(a, frame);
+        }
+
+        // cuma bagian rotasi 3x3 yang dibaca (harus ortonormal)
+        static Vector3<T> matrixToAngles(const Matrix4<T>& m, AxisOrder order,
+                                         RotationFrame frame = RotationFrame::INTRINSIC) {
+            detail::AxisSequence axes = intrinsicSequence(order, frame);
+            int i = axes.first, j = axes.second;
+            T a[3];
+            if (axes.third != i) {
+                // Tait-Bryan: m(i,k) = e sin b, m(j,k) = -e cos b sin a, m(i,j) = -e cos b sin c
+                int k = axes.third;
+                T parity = static_cast<T>(detail::axisParity(i, j));
+                T cosMiddle = std::sqrt(m(i, i) * m(i, i) + m(i, j) * m(i, j));
+                a[1] = std::atan2(parity * m(i, k), cosMiddle);
+                if (cosMiddle > LOCK_EPSILON) {
+                    a[0] = std::atan2(-parity * m(j, k), m(k, k));
+                    a[2] = std::atan2(-parity * m(i, j), m(i, i));
+                } else {
+                    a[0] = std::atan2(parity * m(k, j), m(j, j));
+                    a[2] = static_cast<T>(0);
+                }
+            } else {
+                // Euler klasik (m = sumbu sisa): m(i,i) = cos b, m(j,i) = sin a sin b, m(i,j) = sin c sin b
+                int k = detail::remainingAxis(i, j);
+                T parity = static_cast<T>(detail::axisParity(i, j));
+                T sinMiddle = std::sqrt(m(i, j) * m(i, j) + m(i, k) * m(i, k));
+                a[1] = std::atan2(sinMiddle, m(i, i));
+                if (sinMiddle > LOCK_EPSILON) {
+                    a[0] = std::atan2(m(j, i), -parity * m(k, i));
+                    a[2] = std::atan2(m(i, j), parity * m(i, k));
+                } else {
+                    a[0] = std::atan2(parity * m(k, j), m(j, j));
+                    a[2] = static_cast<T>(0);
+                }
+            }
+            return fromIntrinsic(a, frame);
+        }
+
+        static Vector3<T> convertAngles(const Vector3<T>& angles, AxisOrder fromOrder, RotationFrame fromFrame,
+                                        AxisOrder toOrder, RotationFrame toFrame) {
+            return quaternionToAngles(anglesToQuaternion(angles, fromOrder, fromFrame), toOrder, toFrame);
+        }
+
+        // ---------- batch ----------
+
+        static void anglesToQuaternions(const Vector3Array<T>& angles, AxisOrder order, RotationFrame frame,
+                                        QuaternionArray<T>& out) {
+            out.resize(angles.size());
+            anglesToQuaternions(angles.x.data(), angles.y.data(), angles.z.data(), angles.size(), order, frame,
+                                out.w.data(), out.x.data(), out.y.data(), out.z.data());
+        }
+
+        static void quaternionsToAngles(const QuaternionArray<T>& quaternions, AxisOrder order, RotationFrame frame,
+                                        Vector3Array<T>& out) {
+            out.resize(quaternions.size());
+            quaternionsToAngles(quaternions.w.data(), quaternions.x.data(), quaternions.y.data(), quaternions.z.data(),
+                                quaternions.size(), order, frame, out.x.data(), out.y.data(), out.z.data());
+        }
+
+        static void anglesToMatrices(const Vector3Array<T>& angles, AxisOrder order, RotationFrame frame,
+                                     std::vector<Matrix4<T>>& out) {
+            QuaternionArray<T> quaternions;
+            anglesToQuaternions(angles, order, frame, quaternions);
+            out.resize(angles.size());
+            for (size_t i = 0; i < angles.size(); ++i) {
+                out[i] = Matrix4<T>::fromQuaternion(quaternions.get(i));
+            }
+        }
+
+        // lewat quaternion per potongan, tanpa array antara sepanjang input; out boleh sama dengan angles
+        static void convertAngles(const Vector3Array<T>& angles, AxisOrder fromOrder, RotationFrame fromFrame,
+                                  AxisOrder toOrder, RotationFrame toFrame, Vector3Array<T>& out) {
+            const size_t count = angles.size();
+            out.resize(count);
+            T w[CHUNK_SIZE], x[CHUNK_SIZE], y[CHUNK_SIZE], z[CHUNK_SIZE];
+            for (size_t begin = 0; begin < count; begin += CHUNK_SIZE) {
+                size_t n = std::min(CHUNK_SIZE, count - begin);
+                anglesToQuaternions(angles.x.data() + begin, angles.y.data() + begin, angles.z.data() + begin, n,
+                                    fromOrder, fromFrame, w, x, y, z);
+                quaternionsToAngles(w, x, y, z, n, toOrder, toFrame,
+                                    out.x.data() + begin, out.y.data() + begin, out.z.data() + begin);
+            }
+        }
+
+    private:
+        // batas "sin/cos sudut tengah = 0" (gimbal lock), relatif ke panjang quaternion / kolom matriks
+        static constexpr T LOCK_EPSILON = std::numeric_limits<T>::epsilon() * static_cast<T>(16);
+        static constexpr T PI = static_cast<T>(3.14159265358979323846);
+        static constexpr T HALF_PI = static_cast<T>(1.57079632679489661923);
+
+        // extrinsic = intrinsic dengan urutan sumbu & sudut dibalik
+        static detail::AxisSequence intrinsicSequence(AxisOrder order, RotationFrame frame) {
+            detail::AxisSequence axes = detail::axisSequence(order);
+            if (frame == RotationFrame::EXTRINSIC) std::swap(axes.first, axes.third);
+            return axes;
+        }
+
+        static void toIntrinsic(const Vector3<T>& angles, AxisOrder order, RotationFrame frame,
+                                detail::AxisSequence& axes, T* a) {
+            axes = intrinsicSequence(order, frame);
+            bool reversed = frame == RotationFrame::EXTRINSIC;
+            a[0] = reversed ? angles.z : angles.x;
+            a[1] = angles.y;
+            a[2] = reversed ? angles.x : angles.z;
+        }
+
+        // radian intrinsic -> derajat sesuai frame
+        static Vector3<T> fromIntrinsic(const T* a, RotationFrame frame) {
+            const T toDegrees = FastTrig<T>::RADIANS_TO_DEGREES;
+            bool reversed = frame == RotationFrame::EXTRINSIC;
+            return Vector3<T>((reversed ? a[2] : a[0]) * toDegrees, a[1] * toDegrees, (reversed ? a[0] : a[2]) * toDegrees);
+        }
+
+        // Bentuk Euler klasik (i, j, i), m = sumbu sisa, e = parity(i, j):
+        //   w = cos(b/2) cos((a+c)/2), q_i = cos(b/2) sin((a+c)/2), q_j = sin(b/2) cos((a-c)/2), e q_m = sin(b/2) sin((a-c)/2)
+        // Tait-Bryan (i, j, k): q * (1 + e_j) (putar 90 derajat di j, skala nggak ngaruh ke atan2) sudah berbentuk
+        // Euler klasik (i, j, i) dengan sudut (a, b + 90, -e c)
+        template<int I, int J, int K>
+        static void halfAngleComponents(T w, T x, T y, T z, T* out) {
+            constexpr int M = 3 - I - J;
+            constexpr T PARITY = (J - I + 3) % 3 == 1 ? static_cast<T>(1) : static_cast<T>(-1);
+            T v[3] = {x, y, z};
+            if constexpr (K != I) {
+                detail::multiplyAxis<J>(static_cast<T>(1), static_cast<T>(1), w, v);
+            }
+            out[0] = w;
+            out[1] = v[I];
+            out[2] = v[J];
+            out[3] = PARITY * v[M];
+        }
+
+        static void halfAngleComponents(const detail::AxisSequence& axes, T w, T x, T y, T z, T* out) {
+            detail::dispatchAxisSequence(axes, [&](auto first, auto second, auto third) {
+                halfAngleComponents<decltype(first)::value, decltype(second)::value, decltype(third)::value>(w, x, y, z, out);
+            });
+        }
+
+        // tanpa cabang (cuma select) supaya loop batch-nya divektorisasi
+        static void combineHalfAngles(bool taitBryan, T parity, T sumHalf, T differenceHalf, T middleHalf,
+                                      T sineHalf, T cosineHalf, T* a) {
+            T threshold = LOCK_EPSILON * LOCK_EPSILON * (sineHalf * sineHalf + cosineHalf * cosineHalf);
+            bool nearZero = sineHalf * sineHalf <= threshold;
+            bool nearPi = cosineHalf * cosineHalf <= threshold;
+            T first = nearZero ? static_cast<T>(2) * sumHalf
+                               : (nearPi ? static_cast<T>(2) * differenceHalf : sumHalf + differenceHalf);
+            T third = nearZero || nearPi ? static_cast<T>(0) : sumHalf - differenceHalf;
+            T middle = static_cast<T>(2) * middleHalf;
+            if (taitBryan) {
+                middle -= HALF_PI;
+                third *= -parity;
+            }
+            a[0] = wrapAngle(first);
+            a[1] = middle;
+            a[2] = wrapAngle(third);
+        }
+
+        // (-2pi, 2pi] -> (-pi, pi]
+        static T wrapAngle(T angle) {
+            angle = angle > PI ? angle - static_cast<T>(2) * PI : angle;
+            return angle <= -PI ? angle + static_cast<T>(2) * PI : angle;
+        }
+
+        static void anglesToQuaternions(const T* first, const T* second, const T* third, size_t count,
+                                        AxisOrder order, RotationFrame frame, T* w, T* x, T* y, T* z) {
+            detail::AxisSequence axes = intrinsicSequence(order, frame);
+            if (frame == RotationFrame::EXTRINSIC) std::swap(first, third);
+            const T factor = FastTrig<T>::DEGREES_TO_RADIANS * static_cast<T>(0.5);
+
+            T radians[3][CHUNK_SIZE], sines[3][CHUNK_SIZE], cosines[3][CHUNK_SIZE];
+            const T* inputs[3] = {first, second, third};
+            for (size_t begin = 0; begin < count; begin += CHUNK_SIZE) {
+                size_t n = std::min(CHUNK_SIZE, count - begin);
+                for (int a = 0; a < 3; ++a) {
+                    for (size_t i = 0; i < n; ++i) radians[a][i] = inputs[a][begin + i] * factor;
+                    FastTrig<T>::sincos(radians[a], sines[a], cosines[a], n);
+                }
+                detail::dispatchAxisSequence(axes, [&](auto first, auto second, auto third) {
+                    constexpr int I = decltype(first)::value, J = decltype(second)::value, K = decltype(third)::value;
+                    T* qw = w + begin;
+                    T* qx = x + begin;
+                    T* qy = y + begin;
+                    T* qz = z + begin;
+                    for (size_t i = 0; i < n; ++i) {
+                        T scalar = cosines[0][i];
+                        T v[3] = {0, 0, 0};
+                        v[I] = sines[0][i];
+                        detail::multiplyAxis<J>(sines[1][i], cosines[1][i], scalar, v);
+                        detail::multiplyAxis<K>(sines[2][i], cosines[2][i], scalar, v);
+                        qw[i] = scalar;
+                        qx[i] = v[0];
+                        qy[i] = v[1];
+                        qz[i] = v[2];
+                    }
+                });
+            }
+        }
+
+        static void quaternionsToAngles(const T* w, const T* x, const T* y, const T* z, size_t count,
+                                        AxisOrder order, RotationFrame frame, T* first, T* second, T* third) {
+            detail::AxisSequence axes = intrinsicSequence(order, frame);
+            if (frame == RotationFrame::EXTRINSIC) std::swap(first, third);
+
+            T components[4][CHUNK_SIZE], sineHalf[CHUNK_SIZE], cosineHalf[CHUNK_SIZE];
+            T sumHalf[CHUNK_SIZE], differenceHalf[CHUNK_SIZE], middleHalf[CHUNK_SIZE];
+            for (size_t begin = 0; begin < count; begin += CHUNK_SIZE) {
+                size_t n = std::min(CHUNK_SIZE, count - begin);
+                detail::dispatchAxisSequence(axes, [&](auto first, auto second, auto third) {
+                    constexpr int I = decltype(first)::value, J = decltype(second)::value, K = decltype(third)::value;
+                    for (size_t i = 0; i < n; ++i) {
+                        T out[4];
+                        halfAngleComponents<I, J, K>(w[begin + i], x[begin + i], y[begin + i], z[begin + i], out);
+                        components[0][i] = out[0];
+                        components[1][i] = out[1];
+                        components[2][i] = out[2];
+                        components[3][i] = out[3];
+                        cosineHalf[i] = std::sqrt(out[0] * out[0] + out[1] * out[1]);
+                        sineHalf[i] = std::sqrt(out[2] * out[2] + out[3] * out[3]);
+                    }
+                });
+                FastTrig<T>::atan2(components[1], components[0], sumHalf, n);
+                FastTrig<T>::atan2(components[3], components[2], differenceHalf, n);
+                FastTrig<T>::atan2(sineHalf, cosineHalf, middleHalf, n);
+
+                const T toDegrees = FastTrig<T>::RADIANS_TO_DEGREES;
+                const bool taitBryan = axes.third != axes.first;
+                const T parity = static_cast<T>(detail::axisParity(axes.first, axes.second));
+                for (size_t i = 0; i < n; ++i) {
+                    T a[3];
+                    combineHalfAngles(taitBryan, parity, sumHalf[i], differenceHalf[i], middleHalf[i], sineHalf[i], cosineHalf[i], a);
+                    first[begin + i] = a[0] * toDegrees;
+                    second[begin + i] = a[1] * toDegrees;
+                    third[begin + i] = a[2] * toDegrees;
+                }
+            }
+        }
+    };
+} // namespace math
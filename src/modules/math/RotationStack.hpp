@@ -0,0 +1,224 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "Quaternion.hpp"
+
+namespace math {
+    // Urutan rotasi lokal s0, s1, ..., s(n-1) dengan pose akhir s0 * s1 * ... * s(n-1) (langkah baru dikalikan di kanan,
+    // sama seperti rotasi yang diterapkan berurutan). Disimpan di treap implisit (urut posisi) yang tiap node-nya
+    // menyimpan hasil kali subtree-nya, jadi sisip/hapus/ganti langkah di mana saja O(log n) dan pose akhir maupun
+    // pose antara (prefix) didapat tanpa mengalikan ulang seluruh rantai.
+    //
+    // Langkah dinormalisasi waktu disimpan, dan hasil kali subtree selalu dihitung ulang dari anak-anaknya, jadi error
+    // float nggak menumpuk seiring edit (cuma ~log n perkalian). Kalau renormalizeProducts nyala, tiap hasil kali
+    // subtree & prefix juga dinormalisasi lagi
+    template<typename T>
+    class RotationStack {
+    public:
+        explicit RotationStack(bool renormalizeProducts = true) : renormalizeProducts(renormalizeProducts) {}
+
+        size_t size() const { return nodeSize(root); }
+        bool empty() const { return root == NONE; }
+
+        void clear() {
+            nodes.clear();
+            freeNodes.clear();
+            root = NONE;
+        }
+
+        void setRenormalizeProducts(bool enabled) {
+            renormalizeProducts = enabled;
+            rebuildProducts(root);
+        }
+        bool getRenormalizeProducts() const { return renormalizeProducts; }
+
+        // index == size() berarti tambah di akhir
+        void insert(size_t index, const Quaternion<T>& step) {
+            if (index > size()) throw std::out_of_range("[RotationStack] index sisip di luar rentang.");
+            int left, right;
+            split(root, index, left, right);
+            root = merge(merge(left, allocate(step)), right);
+        }
+
+        void pushBack(const Quaternion<T>& step) { insert(size(), step); }
+
+        void erase(size_t index) {
+            if (index >= size()) throw std::out_of_range("[RotationStack] index hapus di luar rentang.");
+            int left, middle, right;
+            split(root, index, left, middle);
+            split(middle, 1, middle, right);
+            freeNodes.push_back(middle);
+            root = merge(left, right);
+        }
+
+        // ganti langkah tanpa mengubah bentuk tree; cuma node di jalur ke root yang dihitung ulang
+        void set(size_t index, const Quaternion<T>& step) {
+            if (index >= size()) throw std::out_of_range("[RotationStack] index ganti di luar rentang.");
+            int path[MAX_DEPTH];
+            int depth = 0;
+            int node = root;
+            while (true) {
+                path[depth++] = node;
+                size_t leftSize = nodeSize(nodes[node].left);
+                if (index < leftSize) {
+                    node = nodes[node].left;
+                } else if (index == leftSize) {
+                    break;
+                } else {
+                    index -= leftSize + 1;
+                    node = nodes[node].right;
+                }
+            }
+            nodes[node].step = step.normalize();
+            while (depth > 0) {
+                pull(path[--depth]);
+            }
+        }
+
+        const Quaternion<T>& get(size_t index) const {
+            if (index >= size()) throw std::out_of_range("[RotationStack] index di luar rentang.");
+            int node = root;
+            while (true) {
+                size_t leftSize = nodeSize(nodes[node].left);
+                if (index < leftSize) {
+                    node = nodes[node].left;
+                } else if (index == leftSize) {
+                    return nodes[node].step;
+                } else {
+                    index -= leftSize + 1;
+                    node = nodes[node].right;
+                }
+            }
+        }
+
+        // pose akhir s0 * ... * s(n-1); O(1)
+        Quaternion<T> product() const {
+            return root == NONE ? Quaternion<T>() : nodes[root].product;
+        }
+
+        // pose sesudah `count` langkah pertama (s0 * ... * s(count-1)); count di-clamp ke size(). O(log n)
+        Quaternion<T> prefixProduct(size_t count) const {
+            Quaternion<T> result;
+            int node = root;
+            while (node != NONE && count > 0) {
+                const Node& current = nodes[node];
+                size_t leftSize = nodeSize(current.left);
+                if (count <= leftSize) {
+                    node = current.left;
+                } else {
+                    if (current.left != NONE) result = result * nodes[current.left].product;
+                    result = result * current.step;
+                    count -= leftSize + 1;
+                    node = current.right;
+                }
+            }
+            return renormalizeProducts ? result.normalize() : result;
+        }
+
+        // langkah urut posisi (O(n), buat debug/serialisasi)
+        std::vector<Quaternion<T>> toVector() const {
+            std::vector<Quaternion<T>> result;
+            result.reserve(size());
+            collect(root, result);
+            return result;
+        }
+
+    private:
+        static constexpr int NONE = -1;
+        // kedalaman treap dengan prioritas acak ~ 2-3 log2 n; 128 jauh di atas itu buat n yang muat di memori
+        static constexpr int MAX_DEPTH = 128;
+
+        struct Node {
+            Quaternion<T> step;
+            Quaternion<T> product; // left.product * step * right.product
+            uint32_t priority;
+            size_t size;
+            int left;
+            int right;
+        };
+
+        std::vector<Node> nodes;
+        std::vector<int> freeNodes;
+        int root = NONE;
+        uint32_t randomState = 0x9E3779B9u;
+        bool renormalizeProducts;
+
+        size_t nodeSize(int node) const { return node == NONE ? 0 : nodes[node].size; }
+
+        // xorshift32; cukup buat prioritas treap dan hasilnya deterministik
+        uint32_t nextPriority() {
+            randomState ^= randomState << 13;
+            randomState ^= randomState >> 17;
+            randomState ^= randomState << 5;
+            return randomState;
+        }
+
+        int allocate(const Quaternion<T>& step) {
+            Quaternion<T> normalized = step.normalize();
+            Node node{normalized, normalized, nextPriority(), 1, NONE, NONE};
+            if (!freeNodes.empty()) {
+                int index = freeNodes.back();
+                freeNodes.pop_back();
+                nodes[index] = node;
+                return index;
+            }
+            nodes.push_back(node);
+            return static_cast<int>(nodes.size() - 1);
+        }
+
+        void pull(int node) {
+            Node& current = nodes[node];
+            current.size = 1 + nodeSize(current.left) + nodeSize(current.right);
+            Quaternion<T> product = current.step;
+            if (current.left != NONE) product = nodes[current.left].product * product;
+            if (current.right != NONE) product = product * nodes[current.right].product;
+            current.product = renormalizeProducts ? product.normalize() : product;
+        }
+
+        // left = `count` langkah pertama dari subtree node, right = sisanya
+        void split(int node, size_t count, int& left, int& right) {
+            if (node == NONE) {
+                left = right = NONE;
+                return;
+            }
+            size_t leftSize = nodeSize(nodes[node].left);
+            if (count <= leftSize) {
+                split(nodes[node].left, count, left, nodes[node].left);
+                right = node;
+            } else {
+                split(nodes[node].right, count - leftSize - 1, nodes[node].right, right);
+                left = node;
+            }
+            pull(node);
+        }
+
+        int merge(int left, int right) {
+            if (left == NONE) return right;
+            if (right == NONE) return left;
+            if (nodes[left].priority > nodes[right].priority) {
+                nodes[left].right = merge(nodes[left].right, right);
+                pull(left);
+                return left;
+            }
+            nodes[right].left = merge(left, nodes[right].left);
+            pull(right);
+            return right;
+        }
+
+        void rebuildProducts(int node) {
+            if (node == NONE) return;
+            rebuildProducts(nodes[node].left);
+            rebuildProducts(nodes[node].right);
+            pull(node);
+        }
+
+        void collect(int node, std::vector<Quaternion<T>>& out) const {
+            if (node == NONE) return;
+            collect(nodes[node].left, out);
+            out.push_back(nodes[node].step);
+            collect(nodes[node].right, out);
+        }
+    };
+} // namespace math
@@ -0,0 +1,201 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include "Quaternion.hpp"
+
+namespace math {
+    enum class RotationInterpolation {
+        SLERP = 0,
+        NLERP = 1,
+        SQUAD = 2
+    };
+
+    // Track rotasi dengan banyak keyframe. Semua yang bisa dihitung sekali per track (quaternion yang sudah
+    // dinormalisasi dan dibikin satu hemisfer, sudut + 1/sin(sudut) tiap segmen, titik kontrol squad)
+    // disiapkan waktu track berubah, jadi sample cuma binary search waktu + beberapa sin.
+    // Track bukan thread-safe selama masih diubah; sesudah prepare() boleh di-sample dari banyak thread
+    template<typename T>
+    class RotationTrack {
+    public:
+        explicit RotationTrack(RotationInterpolation interpolation = RotationInterpolation::SLERP)
+            : interpolation(interpolation) {}
+
+        // keyframe dengan waktu yang sama menimpa yang lama
+        void addKey(T time, const Quaternion<T>& rotation) {
+            auto it = std::lower_bound(times.begin(), times.end(), time);
+            size_t index = static_cast<size_t>(it - times.begin());
+            if (it != times.end() && *it == time) {
+                rotations[index] = rotation;
+            } else {
+                times.insert(it, time);
+                rotations.insert(rotations.begin() + static_cast<std::ptrdiff_t>(index), rotation);
+            }
+            prepared = false;
+        }
+
+        void clear() {
+            times.clear();
+            rotations.clear();
+            prepared = false;
+        }
+
+        void setInterpolation(RotationInterpolation newInterpolation) {
+            interpolation = newInterpolation;
+        }
+        RotationInterpolation getInterpolation() const { return interpolation; }
+
+        size_t getKeyCount() const { return times.size(); }
+        bool empty() const { return times.empty(); }
+        T getStartTime() const { return times.empty() ? static_cast<T>(0) : times.front(); }
+        T getEndTime() const { return times.empty() ? static_cast<T>(0) : times.back(); }
+        T getDuration() const { return getEndTime() - getStartTime(); }
+
+        // quaternion keyframe sesudah dinormalisasi & dibikin satu hemisfer dengan keyframe sebelumnya
+        const Quaternion<T>& getKey(size_t index) const {
+            prepare();
+            return keys[index];
+        }
+
+        // waktu di luar track (termasuk +-inf) di-clamp ke keyframe pertama/terakhir, waktu NaN dianggap keyframe
+        // pertama; O(log n)
+        Quaternion<T> sample(T time) const {
+            prepare();
+            if (keys.empty()) return Quaternion<T>();
+            // NaN lolos semua perbandingan dan bikin upper_bound balik end(), jadi ditolak duluan
+            if (keys.size() == 1 || std::isnan(time) || time <= times.front()) return keys.front();
+            if (time >= times.back()) return keys.back();
+
+            size_t segment = static_cast<size_t>(std::upper_bound(times.begin(), times.end(), time) - times.begin()) - 1;
+            return sampleSegment(segment, time);
+        }
+
+        // banyak waktu sekaligus (mis. ghost/onion-skin, timeline). Kalau times naik, segmen dicari maju
+        // dari segmen sebelumnya (total O(n + m)); kalau mundur, balik ke binary search
+        void sampleBatch(const T* sampleTimes, size_t count, Quaternion<T>* out) const {
+            prepare();
+            if (keys.size() < 2) {
+                Quaternion<T> constant = keys.empty() ? Quaternion<T>() : keys.front();
+                std::fill(out, out + count, constant);
+                return;
+            }
+
+            size_t segment = 0;
+            T previousTime = times.front();
+            for (size_t i = 0; i < count; ++i) {
+                T time = sampleTimes[i];
+                if (std::isnan(time) || time <= times.front()) {
+                    out[i] = keys.front();
+                    continue;
+                }
+                if (time >= times.back()) {
+                    out[i] = keys.back();
+                    continue;
+                }
+                if (time < previousTime) {
+                    segment = static_cast<size_t>(std::upper_bound(times.begin(), times.end(), time) - times.begin()) - 1;
+                } else {
+                    while (times[segment + 1] <= time) ++segment;
+                }
+                previousTime = time;
+                out[i] = sampleSegment(segment, time);
+            }
+        }
+
+        // dipanggil otomatis oleh sample; bisa dipanggil duluan supaya sample pertama nggak kena biaya O(n)
+        void prepare() const {
+            if (prepared) return;
+
+            keys.resize(rotations.size());
+            for (size_t i = 0; i < rotations.size(); ++i) {
+                keys[i] = rotations[i].normalize();
+                // q dan -q rotasinya sama; pilih yang dekat dengan keyframe sebelumnya supaya jalurnya terpendek
+                if (i > 0 && keys[i - 1].dot(keys[i]) < static_cast<T>(0)) {
+                    keys[i] = keys[i].negate();
+                }
+            }
+
+            // ujung track: keyframe tetangga dianggap sama dengan dirinya sendiri
+            controlPoints.resize(keys.size());
+            for (size_t i = 0; i < keys.size(); ++i) {
+                const Quaternion<T>& previous = keys[i > 0 ? i - 1 : i];
+                const Quaternion<T>& next = keys[i + 1 < keys.size() ? i + 1 : i];
+                controlPoints[i] = Quaternion<T>::squadControlPoint(previous, keys[i], next);
+            }
+
+            size_t segmentCount = keys.empty() ? 0 : keys.size() - 1;
+            segments.resize(segmentCount);
+            for (size_t i = 0; i < segmentCount; ++i) {
+                segments[i].inverseDuration = static_cast<T>(1) / (times[i + 1] - times[i]);
+                segments[i].keyArc = Arc(keys[i], keys[i + 1]);
+                segments[i].controlArc = Arc(controlPoints[i], controlPoints[i + 1]);
+            }
+            prepared = true;
+        }
+
+    private:
+        static constexpr T PARALLEL_EPSILON = static_cast<T>(1e-5);
+
+        // busur slerp a -> b yang sudut & 1/sin-nya sudah dihitung (tanpa milih jalur terpendek)
+        struct Arc {
+            T omega = static_cast<T>(0);
+            T inverseSinOmega = static_cast<T>(0);
+            bool nearlyParallel = true;
+
+            Arc() = default;
+            Arc(const Quaternion<T>& a, const Quaternion<T>& b) {
+                T cosOmega = std::max(static_cast<T>(-1), std::min(static_cast<T>(1), a.dot(b)));
+                nearlyParallel = std::abs(cosOmega) > static_cast<T>(1) - PARALLEL_EPSILON;
+                omega = std::acos(cosOmega);
+                inverseSinOmega = nearlyParallel ? static_cast<T>(0) : static_cast<T>(1) / std::sin(omega);
+            }
+
+            Quaternion<T> interpolate(const Quaternion<T>& a, const Quaternion<T>& b, T t) const {
+                if (nearlyParallel) {
+                    return Quaternion<T>::blend(a, b, static_cast<T>(1) - t, t).normalize();
+                }
+                return Quaternion<T>::blend(a, b,
+                                            std::sin((static_cast<T>(1) - t) * omega) * inverseSinOmega,
+                                            std::sin(t * omega) * inverseSinOmega);
+            }
+        };
+
+        struct Segment {
+            T inverseDuration;
+            Arc keyArc;
+            Arc controlArc; // antar titik kontrol squad
+        };
+
+        RotationInterpolation interpolation;
+        std::vector<T> times;
+        std::vector<Quaternion<T>> rotations;
+
+        // cache hasil prepare()
+        mutable bool prepared = false;
+        mutable std::vector<Quaternion<T>> keys;
+        mutable std::vector<Segment> segments;
+        mutable std::vector<Quaternion<T>> controlPoints;
+
+        Quaternion<T> sampleSegment(size_t index, T time) const {
+            const Segment& segment = segments[index];
+            const Quaternion<T>& a = keys[index];
+            const Quaternion<T>& b = keys[index + 1];
+            T t = (time - times[index]) * segment.inverseDuration;
+
+            switch (interpolation) {
+            case RotationInterpolation::NLERP:
+                return Quaternion<T>::blend(a, b, static_cast<T>(1) - t, t).normalize();
+            case RotationInterpolation::SQUAD: {
+                // sama dengan Quaternion::squad, tapi dua slerp dalamnya pakai busur yang sudah di-cache
+                Quaternion<T> onKeys = segment.keyArc.interpolate(a, b, t);
+                Quaternion<T> onControls = segment.controlArc.interpolate(controlPoints[index], controlPoints[index + 1], t);
+                return Quaternion<T>::slerpNoFlip(onKeys, onControls, static_cast<T>(2) * t * (static_cast<T>(1) - t));
+            }
+            case RotationInterpolation::SLERP:
+            default:
+                return segment.keyArc.interpolate(a, b, t);
+            }
+        }
+    };
+} // namespace math
@@ -0,0 +1,155 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Vector3.hpp"
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "FastTrig.hpp"
+
+namespace math {
+    // Quaternion unit (titik di S^3) dipetakan ke R^3 buat digambar sebagai point cloud.
+    //
+    // Stereografik dari kutub -1: p = (x, y, z) / (1 + w). q dan -q (rotasi yang sama) disamakan dulu ke w >= 0,
+    // jadi semua rotasi masuk bola unit: identitas di pusat, jarak dari pusat = tan(sudut / 4), kulit bola = rotasi
+    // 180° (dua titik berseberangan di kulit = rotasi yang sama).
+    //
+    // Fibrasi Hopf: titik dasar rotasi q = arah sumbu z sesudah diputar (q k q^-1, di S^2). Semua q * (putar z
+    // sebesar t) punya titik dasar yang sama; himpunan itu satu fiber, lingkaran besar di S^3 (di SO(3) tertutup
+    // sesudah t = 2 pi). Di proyeksi stereografik fiber kelihatan sebagai lingkaran-lingkaran yang saling mengait.
+    //
+    // Semua fungsi *Range cuma menulis [begin, end) dan sampel acaknya di-hash dari index (bukan state RNG), jadi
+    // boleh dipanggil paralel per potongan dan hasilnya nggak bergantung pada cara membagi. Trigonometrinya per blok
+    // BLOCK_SIZE lewat FastTrig batch (SIMD)
+    template<typename T>
+    class S3Projection {
+    public:
+        // ukuran potongan yang wajar buat dibagi ke thread
+        static constexpr size_t CHUNK_SIZE = 16384;
+        static constexpr size_t BLOCK_SIZE = 256;
+
+        static Vector3<T> stereographic(const Quaternion<T>& q) {
+            T sign = q.w < static_cast<T>(0) ? static_cast<T>(-1) : static_cast<T>(1);
+            T scale = sign / (static_cast<T>(1) + sign * q.w);
+            return Vector3<T>(q.x * scale, q.y * scale, q.z * scale);
+        }
+
+        static Vector3<T> hopfBase(const Quaternion<T>& q) {
+            // kolom ketiga matriks rotasi q
+            return Vector3<T>(static_cast<T>(2) * (q.x * q.z + q.w * q.y),
+                              static_cast<T>(2) * (q.y * q.z - q.w * q.x),
+                              static_cast<T>(1) - static_cast<T>(2) * (q.x * q.x + q.y * q.y));
+        }
+
+        // radius = skala bola unit di dunia
+        static void stereographicRange(simd::QuaternionView<const T> in, Vector3<T>* out, T radius, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                T sign = in.w[i] < static_cast<T>(0) ? static_cast<T>(-1) : static_cast<T>(1);
+                T scale = radius * sign / (static_cast<T>(1) + sign * in.w[i]);
+                out[i] = Vector3<T>(in.x[i] * scale, in.y[i] * scale, in.z[i] * scale);
+            }
+        }
+
+        // kelompok warna 0..bucketCount-1 dari azimuth titik dasar Hopf
+        static void hopfBucketRange(simd::QuaternionView<const T> in, uint8_t* out, size_t bucketCount, size_t begin, size_t end) {
+            const T pi = static_cast<T>(3.141592653589793);
+            T baseX[BLOCK_SIZE], baseY[BLOCK_SIZE], azimuth[BLOCK_SIZE];
+            for (size_t blockBegin = begin; blockBegin < end; blockBegin += BLOCK_SIZE) {
+                size_t count = std::min(BLOCK_SIZE, end - blockBegin);
+                for (size_t j = 0; j < count; ++j) {
+                    size_t i = blockBegin + j;
+                    baseX[j] = in.x[i] * in.z[i] + in.w[i] * in.y[i];
+                    baseY[j] = in.y[i] * in.z[i] - in.w[i] * in.x[i];
+                }
+                FastTrig<T>::atan2(baseY, baseX, azimuth, count);
+                for (size_t j = 0; j < count; ++j) {
+                    size_t bucket = static_cast<size_t>((azimuth[j] + pi) / (static_cast<T>(2) * pi) * static_cast<T>(bucketCount));
+                    out[blockBegin + j] = static_cast<uint8_t>(std::min(bucket, bucketCount - 1));
+                }
+            }
+        }
+
+        // fiber lewat q: q * (putar z sebesar t), t = 0..2 pi, segments + 1 titik (titik terakhir = titik pertama)
+        static void fiber(const Quaternion<T>& q, size_t segments, std::vector<Quaternion<T>>& out) {
+            out.resize(segments + 1);
+            for (size_t i = 0; i <= segments; ++i) {
+                T halfAngle = static_cast<T>(3.141592653589793) * static_cast<T>(i) / static_cast<T>(segments);
+                out[i] = q * Quaternion<T>(std::cos(halfAngle), static_cast<T>(0), static_cast<T>(0), std::sin(halfAngle));
+            }
+        }
+
+        // rotasi yang membawa sumbu z ke base (unit) lewat busur terpendek; fiber di atas base = fiber(baseRotation(base))
+        static Quaternion<T> baseRotation(const Vector3<T>& base) {
+            // setengah jalan antara z dan base: q = (1 + bz, -by, bx, 0) / |.|
+            T w = static_cast<T>(1) + base.z;
+            if (w < static_cast<T>(1e-6)) {
+                return Quaternion<T>(static_cast<T>(0), static_cast<T>(1), static_cast<T>(0), static_cast<T>(0));
+            }
+            return Quaternion<T>(w, -base.y, base.x, static_cast<T>(0)).normalize();
+        }
+
+        // seragam di SO(3) (Shoemake)
+        static void sampleUniformRange(simd::QuaternionView<T> out, uint64_t seed, size_t begin, size_t end) {
+            const T twoPi = static_cast<T>(6.283185307179586);
+            T angles[2 * BLOCK_SIZE], sines[2 * BLOCK_SIZE], cosines[2 * BLOCK_SIZE];
+            for (size_t blockBegin = begin; blockBegin < end; blockBegin += BLOCK_SIZE) {
+                size_t count = std::min(BLOCK_SIZE, end - blockBegin);
+                for (size_t j = 0; j < count; ++j) {
+                    size_t i = blockBegin + j;
+                    angles[2 * j] = twoPi * uniform(seed, i * 3 + 1);
+                    angles[2 * j + 1] = twoPi * uniform(seed, i * 3 + 2);
+                }
+                FastTrig<T>::sincos(angles, sines, cosines, 2 * count);
+                for (size_t j = 0; j < count; ++j) {
+                    size_t i = blockBegin + j;
+                    T u1 = uniform(seed, i * 3);
+                    T a = std::sqrt(static_cast<T>(1) - u1), b = std::sqrt(u1);
+                    out.w[i] = a * sines[2 * j];
+                    out.x[i] = a * cosines[2 * j];
+                    out.y[i] = b * sines[2 * j + 1];
+                    out.z[i] = b * cosines[2 * j + 1];
+                }
+            }
+        }
+
+        // center * (putar sebesar <= maxAngle radian di sumbu acak); sudutnya ~ akar pangkat tiga biar rata per volume
+        static void sampleNearRange(const Quaternion<T>& center, T maxAngle, simd::QuaternionView<T> out, uint64_t seed,
+                                    size_t begin, size_t end) {
+            const T twoPi = static_cast<T>(6.283185307179586);
+            T angles[2 * BLOCK_SIZE], sines[2 * BLOCK_SIZE], cosines[2 * BLOCK_SIZE];
+            for (size_t blockBegin = begin; blockBegin < end; blockBegin += BLOCK_SIZE) {
+                size_t count = std::min(BLOCK_SIZE, end - blockBegin);
+                for (size_t j = 0; j < count; ++j) {
+                    size_t i = blockBegin + j;
+                    angles[2 * j] = twoPi * uniform(seed, i * 3 + 1);                                        // azimuth sumbu
+                    angles[2 * j + 1] = maxAngle * std::cbrt(uniform(seed, i * 3 + 2)) / static_cast<T>(2); // setengah sudut
+                }
+                FastTrig<T>::sincos(angles, sines, cosines, 2 * count);
+                for (size_t j = 0; j < count; ++j) {
+                    size_t i = blockBegin + j;
+                    T axisZ = static_cast<T>(2) * uniform(seed, i * 3) - static_cast<T>(1);
+                    T ring = std::sqrt(std::max(static_cast<T>(0), static_cast<T>(1) - axisZ * axisZ));
+                    T s = sines[2 * j + 1];
+                    Quaternion<T> offset(cosines[2 * j + 1], ring * cosines[2 * j] * s, ring * sines[2 * j] * s, axisZ * s);
+                    Quaternion<T> q = center * offset;
+                    out.w[i] = q.w;
+                    out.x[i] = q.x;
+                    out.y[i] = q.y;
+                    out.z[i] = q.z;
+                }
+            }
+        }
+
+    private:
+        // splitmix64 dari (seed, index) -> [0, 1)
+        static T uniform(uint64_t seed, uint64_t index) {
+            uint64_t z = seed + (index + 1) * 0x9E3779B97F4A7C15ull;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            z ^= z >> 31;
+            return static_cast<T>(static_cast<double>(z >> 11) * (1.0 / 9007199254740992.0));
+        }
+    };
+} // namespace math
@@ -0,0 +1,934 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Kernel SIMD buat Matrix4 & Quaternion. Semua kernel dikompilasi pakai atribut target per fungsi
+// (tanpa -mavx2 global), jadi binary tetap jalan di CPU lama; pilihan kernel dilakukan saat runtime
+// lewat __builtin_cpu_supports, lalu dicek dulu terhadap versi skalar sebelum dipakai (lihat Matrix4::kernels()).
+// Layout: matriks row-major data[row * 4 + col], quaternion (w, x, y, z).
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define QV_SIMD_X86 1
+#include <immintrin.h>
+#define QV_SIMD_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace math {
+namespace simd {
+    // nullptr = pakai jalur skalar.
+    // Operasi per-vektor / per-quaternion cuma punya versi batch: satu panggilan lewat function pointer
+    // lebih mahal dari 16 FMA yang sudah di-inline (diukur), jadi dispatch baru untung kalau count-nya banyak
+    template<typename T>
+    struct MatrixKernels {
+        void (*multiply)(const T* a, const T* b, T* out) = nullptr;
+        // out[i] = m * in[i], vektor 4 komponen berurutan
+        void (*transformVectors)(const T* m, const T* in, T* out, size_t count) = nullptr;
+        // return false kalau determinannya nol (out nggak diisi)
+        bool (*inverse)(const T* m, T* out) = nullptr;
+        const char* name = "scalar";
+    };
+
+    template<typename T>
+    struct QuaternionKernels {
+        // out[i] = a[i] * b[i], quaternion (w, x, y, z) berurutan
+        void (*multiplyBatch)(const T* a, const T* b, T* out, size_t count) = nullptr;
+        const char* name = "scalar";
+    };
+
+    // array SoA: komponen ke-i ada di x[i], y[i], z[i] (T boleh const buat input)
+    template<typename T>
+    struct Vector3View {
+        T* x;
+        T* y;
+        T* z;
+    };
+    template<typename T>
+    struct QuaternionView {
+        T* w;
+        T* x;
+        T* y;
+        T* z;
+    };
+
+    // kernel batch SoA (lihat QuaternionBatch). Tiap kernel cuma ngerjain kelipatan lebar register
+    // dan mengembalikan jumlah elemen yang sudah dikerjakan; sisanya dikerjakan versi skalar
+    template<typename T>
+    struct QuaternionBatchKernels {
+        // satu quaternion unit q = (w, x, y, z) buat semua vektor
+        size_t (*rotate)(const T* q, Vector3View<const T> in, Vector3View<T> out, size_t count) = nullptr;
+        // quaternion unit ke-i buat vektor ke-i
+        size_t (*rotateEach)(QuaternionView<const T> q, Vector3View<const T> in, Vector3View<T> out, size_t count) = nullptr;
+        // in-place; panjang nol -> identitas
+        size_t (*normalize)(QuaternionView<T> q, size_t count) = nullptr;
+        const char* name = "scalar";
+    };
+
+    // sin & cos sekaligus buat array sudut (radian), dan atan2 per elemen; sama seperti kernel batch lain,
+    // return jumlah yang dikerjakan
+    template<typename T>
+    struct TrigKernels {
+        size_t (*sincos)(const T* angles, T* sines, T* cosines, size_t count) = nullptr;
+        size_t (*atan2)(const T* y, const T* x, T* out, size_t count) = nullptr;
+        const char* name = "scalar";
+    };
+
+    // jumlahan buat best-fit rotasi (lihat PointAlignment.hpp) dari pasangan titik source[i] -> target[i], relatif ke
+    // origin (source xyz, target xyz) supaya nggak kehilangan presisi di koordinat yang jauh dari nol.
+    // sums (ALIGNMENT_SUM_COUNT): sum a (3), sum b (3), sum a_r * b_c (9, r baris), sum |a|^2, sum |b|^2.
+    // Sama seperti kernel batch lain: ngerjain kelipatan lebar register, return jumlahnya; sums ditimpa
+    constexpr size_t ALIGNMENT_SUM_COUNT = 17;
+
+    template<typename T>
+    struct AlignmentKernels {
+        size_t (*accumulate)(Vector3View<const T> source, Vector3View<const T> target, const T* origin, size_t count,
+                             T* sums) = nullptr;
+        const char* name = "scalar";
+    };
+
+    namespace detail {
+        // Konstanta sincos: reduksi Cody-Waite ke [-pi/4, pi/4] (pi/2 dipecah 3 bagian supaya q * PIO2_1 eksak),
+        // lalu polinomial minimax cephes. ROUND_MAGIC: (x + M) - M = pembulatan ke integer terdekat tanpa SSE4.1
+        template<typename T> struct SinCosConstants;
+        template<> struct SinCosConstants<float> {
+            static constexpr float TWO_OVER_PI = 0.636619772367581343f;
+            static constexpr float PIO2_1 = 1.5703125f;
+            static constexpr float PIO2_2 = 4.837512969970703125e-4f;
+            static constexpr float PIO2_3 = 7.54978995489188216e-8f;
+            static constexpr float ROUND_MAGIC = 12582912.0f; // 1.5 * 2^23
+            static constexpr float SIN[3] = {-1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f};
+            static constexpr float COS[3] = {4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f};
+        };
+        template<> struct SinCosConstants<double> {
+            static constexpr double TWO_OVER_PI = 0.636619772367581343075535053490057448;
+            static constexpr double PIO2_1 = 1.57079632673412561417e+00;
+            static constexpr double PIO2_2 = 6.07710050630396597660e-11;
+            static constexpr double PIO2_3 = 2.02226624871116645580e-21;
+            static constexpr double ROUND_MAGIC = 6755399441055744.0; // 1.5 * 2^52
+            static constexpr double SIN[6] = {-1.66666666666666307295e-1, 8.33333333332211858878e-3, -1.98412698295895385996e-4,
+                                              2.75573136213857245213e-6, -2.50507477628578072866e-8, 1.58962301576546568060e-10};
+            static constexpr double COS[6] = {4.16666666666665929218e-2, -1.38888888888730564116e-3, 2.48015872888517045348e-5,
+                                              -2.75573141792967388112e-7, 2.08757008419747316778e-9, -1.13585365213876817300e-11};
+        };
+
+        // Konstanta atan: argumen direduksi ke |t| <= tan(pi/8) (lihat Atan2Step), lalu cephes: polinomial buat float,
+        // rasional P/Q buat double (Q monik, koefisien z^5 = 1 nggak ditulis)
+        template<typename T> struct AtanConstants;
+        template<> struct AtanConstants<float> {
+            static constexpr bool RATIONAL = false;
+            static constexpr float P[4] = {-3.33329491539e-1f, 1.99777106478e-1f, -1.38776856032e-1f, 8.05374449538e-2f};
+            static constexpr float Q[1] = {0.0f};
+        };
+        template<> struct AtanConstants<double> {
+            static constexpr bool RATIONAL = true;
+            static constexpr double P[5] = {-6.485021904942025371773e1, -1.228866684490136173410e2, -7.500855792314704667340e1,
+                                            -1.615753718733365076637e1, -8.750608600031904122785e-1};
+            static constexpr double Q[5] = {1.945506571482613964425e2, 4.853903996359136964868e2, 4.328810604912902668951e2,
+                                            1.650270098316988542046e2, 2.485846490142306297962e1};
+        };
+
+        // "lane" selebar satu elemen; dipakai FastTrig supaya versi skalar dan SIMD satu implementasi.
+        // Mask di sini 1/0 (di lane SIMD: semua bit 1/0)
+        template<typename T>
+        struct ScalarLanes {
+            using Scalar = T;
+            using Reg = T;
+            static constexpr size_t WIDTH = 1;
+            static Reg load(const T* p) { return *p; }
+            static void store(T* p, Reg v) { *p = v; }
+            static Reg set1(T v) { return v; }
+            static Reg add(Reg a, Reg b) { return a + b; }
+            static Reg sub(Reg a, Reg b) { return a - b; }
+            static Reg mul(Reg a, Reg b) { return a * b; }
+            static Reg div(Reg a, Reg b) { return a / b; }
+            static Reg fmadd(Reg a, Reg b, Reg c) { return a * b + c; }
+            static Reg abs(Reg a) { return std::abs(a); }
+            static Reg min(Reg a, Reg b) { return a < b ? a : b; }
+            static Reg max(Reg a, Reg b) { return a > b ? a : b; }
+            static Reg lessThan(Reg a, Reg b) { return a < b ? static_cast<T>(1) : static_cast<T>(0); }
+            static Reg isZero(Reg a) { return a == static_cast<T>(0) ? static_cast<T>(1) : static_cast<T>(0); }
+            static Reg select(Reg mask, Reg a, Reg b) { return mask != static_cast<T>(0) ? a : b; }
+        };
+
+        // dipakai juga dengan lane AVX dari kernel ber-target (lihat bagian batch SoA); peringatan ABI-nya nggak relevan
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+        // Tanpa cabang & tanpa operasi bit: kuadran k = q mod 4 dihitung pakai pembulatan magic number,
+        // tukar sin/cos & tanda pakai perkalian dengan 0/1 dan +-1 (eksak). Butuh |x * 2/pi| < 2^21 (float: ~2^15
+        // supaya q * PIO2_1 tetap eksak, lihat FastTrig)
+        template<typename L>
+        struct SinCosStep {
+            using Reg = typename L::Reg;
+            using C = SinCosConstants<typename L::Scalar>;
+
+            static void apply(const Reg& x, Reg& sine, Reg& cosine) {
+                const Reg one = L::set1(1);
+                const Reg half = L::set1(static_cast<typename L::Scalar>(0.5));
+                const Reg two = L::set1(2);
+                // pembulatan ditulis langsung (bukan helper yang return Reg) supaya nggak ada fungsi tanpa target yang
+                // mengembalikan register AVX
+                const Reg magic = L::set1(C::ROUND_MAGIC);
+
+                Reg q = L::sub(L::add(L::mul(x, L::set1(C::TWO_OVER_PI)), magic), magic);
+                Reg r = L::sub(x, L::mul(q, L::set1(C::PIO2_1)));
+                r = L::sub(r, L::mul(q, L::set1(C::PIO2_2)));
+                r = L::sub(r, L::mul(q, L::set1(C::PIO2_3)));
+                Reg z = L::mul(r, r);
+
+                constexpr size_t TERMS = sizeof(C::SIN) / sizeof(C::SIN[0]);
+                Reg sinPoly = L::set1(C::SIN[TERMS - 1]);
+                Reg cosPoly = L::set1(C::COS[TERMS - 1]);
+                for (size_t i = TERMS - 1; i-- > 0;) {
+                    sinPoly = L::fmadd(sinPoly, z, L::set1(C::SIN[i]));
+                    cosPoly = L::fmadd(cosPoly, z, L::set1(C::COS[i]));
+                }
+                Reg s = L::fmadd(L::mul(sinPoly, z), r, r);
+                Reg c = L::fmadd(L::mul(cosPoly, z), z, L::sub(one, L::mul(half, z)));
+
+                // k = q mod 4; odd = k mod 2; upper = k >= 2
+                Reg quarter = L::mul(L::sub(q, L::set1(static_cast<typename L::Scalar>(1.5))),
+                                     L::set1(static_cast<typename L::Scalar>(0.25)));
+                Reg k = L::sub(q, L::mul(L::set1(4), L::sub(L::add(quarter, magic), magic)));
+                Reg upper = L::sub(L::add(L::mul(L::sub(k, half), half), magic), magic);
+                Reg odd = L::sub(k, L::mul(two, upper));
+                Reg even = L::sub(one, odd);
+                Reg sinSign = L::sub(one, L::mul(two, upper));
+                Reg cosSign = L::mul(sinSign, L::sub(one, L::mul(two, odd)));
+
+                sine = L::mul(sinSign, L::fmadd(s, even, L::mul(c, odd)));
+                cosine = L::mul(cosSign, L::fmadd(c, even, L::mul(s, odd)));
+            }
+        };
+
+        // atan2 tanpa cabang: t = min(|x|,|y|) / max(|x|,|y|) di [0, 1]; kalau t > tan(pi/8) pakai
+        // atan(t) = pi/4 + atan((t-1)/(t+1)) (ditulis jadi satu pembagian), lalu kuadrannya dibalikin pakai select.
+        // (0, 0) -> 0; tanda nol nggak dibedakan (atan2(0, -0) = 0, bukan pi seperti std::atan2)
+        template<typename L>
+        struct Atan2Step {
+            using Reg = typename L::Reg;
+            using Scalar = typename L::Scalar;
+            using C = AtanConstants<Scalar>;
+
+            static void apply(const Reg& y, const Reg& x, Reg& angle) {
+                const Reg zero = L::set1(0);
+                const Reg one = L::set1(1);
+                const Reg quarterPi = L::set1(static_cast<Scalar>(0.78539816339744830962));
+                const Reg halfPi = L::set1(static_cast<Scalar>(1.57079632679489661923));
+                const Reg pi = L::set1(static_cast<Scalar>(3.14159265358979323846));
+
+                Reg ax = L::abs(x);
+                Reg ay = L::abs(y);
+                Reg smaller = L::min(ax, ay);
+                Reg larger = L::max(ax, ay);
+                // t > tan(pi/8) dicek tanpa pembagian
+                Reg reduced = L::lessThan(L::mul(L::set1(static_cast<Scalar>(0.41421356237309504880)), larger), smaller);
+                Reg numerator = L::select(reduced, L::sub(smaller, larger), smaller);
+                Reg denominator = L::select(reduced, L::add(smaller, larger), larger);
+                Reg t = L::div(numerator, L::select(L::isZero(denominator), one, denominator));
+                Reg z = L::mul(t, t);
+
+                Reg poly;
+                if constexpr (C::RATIONAL) {
+                    constexpr size_t TERMS = sizeof(C::P) / sizeof(C::P[0]);
+                    Reg p = L::set1(C::P[TERMS - 1]);
+                    Reg q = L::add(z, L::set1(C::Q[TERMS - 1]));
+                    for (size_t i = TERMS - 1; i-- > 0;) {
+                        p = L::fmadd(p, z, L::set1(C::P[i]));
+                        q = L::fmadd(q, z, L::set1(C::Q[i]));
+                    }
+                    poly = L::div(p, q);
+                } else {
+                    constexpr size_t TERMS = sizeof(C::P) / sizeof(C::P[0]);
+                    poly = L::set1(C::P[TERMS - 1]);
+                    for (size_t i = TERMS - 1; i-- > 0;) {
+                        poly = L::fmadd(poly, z, L::set1(C::P[i]));
+                    }
+                }
+                Reg result = L::add(L::select(reduced, quarterPi, zero), L::fmadd(L::mul(poly, z), t, t));
+
+                result = L::select(L::lessThan(ax, ay), L::sub(halfPi, result), result);
+                result = L::select(L::lessThan(x, zero), L::sub(pi, result), result);
+                angle = L::select(L::lessThan(y, zero), L::sub(zero, result), result);
+            }
+        };
+
+        template<typename L>
+        size_t atan2Soa(const typename L::Scalar* y, const typename L::Scalar* x, typename L::Scalar* out, size_t count) {
+            size_t i = 0;
+            for (; i + L::WIDTH <= count; i += L::WIDTH) {
+                typename L::Reg angle;
+                Atan2Step<L>::apply(L::load(y + i), L::load(x + i), angle);
+                L::store(out + i, angle);
+            }
+            return i;
+        }
+
+        template<typename L>
+        size_t sincosSoa(const typename L::Scalar* angles, typename L::Scalar* sines, typename L::Scalar* cosines, size_t count) {
+            size_t i = 0;
+            for (; i + L::WIDTH <= count; i += L::WIDTH) {
+                typename L::Reg s, c;
+                SinCosStep<L>::apply(L::load(angles + i), s, c);
+                L::store(sines + i, s);
+                L::store(cosines + i, c);
+            }
+            return i;
+        }
+#pragma GCC diagnostic pop
+    } // namespace detail
+
+#ifdef QV_SIMD_X86
+    namespace detail {
+        // ---------- float, SSE2 (baseline x86-64) ----------
+        QV_SIMD_TARGET("sse2")
+        inline void multiplyFloatSse(const float* a, const float* b, float* out) {
+            __m128 b0 = _mm_loadu_ps(b);
+            __m128 b1 = _mm_loadu_ps(b + 4);
+            __m128 b2 = _mm_loadu_ps(b + 8);
+            __m128 b3 = _mm_loadu_ps(b + 12);
+            for (int i = 0; i < 4; ++i) {
+                const float* row = a + i * 4;
+                __m128 r = _mm_mul_ps(_mm_set1_ps(row[0]), b0);
+                r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(row[1]), b1));
+                r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(row[2]), b2));
+                r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(row[3]), b3));
+                _mm_storeu_ps(out + i * 4, r);
+            }
+        }
+
+        QV_SIMD_TARGET("sse2")
+        inline void transformVectorsFloatSse(const float* m, const float* in, float* out, size_t count) {
+            __m128 c0 = _mm_loadu_ps(m);
+            __m128 c1 = _mm_loadu_ps(m + 4);
+            __m128 c2 = _mm_loadu_ps(m + 8);
+            __m128 c3 = _mm_loadu_ps(m + 12);
+            // baris -> kolom sekali di depan, jadi tiap vektor = sum(kolom_k * v[k]) tanpa horizontal add
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+            for (size_t i = 0; i < count; ++i, in += 4, out += 4) {
+                __m128 r = _mm_mul_ps(c0, _mm_set1_ps(in[0]));
+                r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(in[1])));
+                r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(in[2])));
+                r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_set1_ps(in[3])));
+                _mm_storeu_ps(out, r);
+            }
+        }
+
+        // blok 2x2 disimpan sebagai satu __m128 (a0 a1 / a2 a3)
+        QV_SIMD_TARGET("sse2")
+        inline __m128 mat2Multiply(__m128 a, __m128 b) {
+            return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                                         _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+        // adj(a) * b
+        QV_SIMD_TARGET("sse2")
+        inline __m128 mat2AdjMultiply(__m128 a, __m128 b) {
+            return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)),
+                                         _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+        // a * adj(b)
+        QV_SIMD_TARGET("sse2")
+        inline __m128 mat2MultiplyAdj(__m128 a, __m128 b) {
+            return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                                         _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        // invers lewat dekomposisi blok 2x2 (M = [A B; C D]), butuh jauh lebih sedikit operasi dari kofaktor penuh
+        QV_SIMD_TARGET("sse2")
+        inline bool inverseFloatSse(const float* m, float* out) {
+            __m128 r0 = _mm_loadu_ps(m);
+            __m128 r1 = _mm_loadu_ps(m + 4);
+            __m128 r2 = _mm_loadu_ps(m + 8);
+            __m128 r3 = _mm_loadu_ps(m + 12);
+
+            __m128 A = _mm_movelh_ps(r0, r1);
+            __m128 B = _mm_movehl_ps(r1, r0);
+            __m128 C = _mm_movelh_ps(r2, r3);
+            __m128 D = _mm_movehl_ps(r3, r2);
+
+            // (|A| |B| |C| |D|)
+            __m128 detSub = _mm_sub_ps(
+                _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+                _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0)))
+            );
+            __m128 detA = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 detB = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(1, 1, 1, 1));
+            __m128 detC = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(2, 2, 2, 2));
+            __m128 detD = _mm_shuffle_ps(detSub, detSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+            __m128 DC = mat2AdjMultiply(D, C);
+            __m128 AB = mat2AdjMultiply(A, B);
+            __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), mat2Multiply(B, DC));
+            __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), mat2Multiply(C, AB));
+            __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), mat2MultiplyAdj(D, AB));
+            __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), mat2MultiplyAdj(A, DC));
+
+            // |M| = |A||D| + |B||C| - tr(adj(A)B * adj(D)C)
+            __m128 detM = _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC));
+            __m128 trace = _mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, _MM_SHUFFLE(3, 1, 2, 0)));
+            trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+            trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+            detM = _mm_sub_ps(detM, trace);
+
+            if (_mm_cvtss_f32(detM) == 0.0f) {
+                return false;
+            }
+
+            __m128 reciprocal = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+            X = _mm_mul_ps(X, reciprocal);
+            Y = _mm_mul_ps(Y, reciprocal);
+            Z = _mm_mul_ps(Z, reciprocal);
+            W = _mm_mul_ps(W, reciprocal);
+
+            // adjugate tiap blok + susun balik jadi baris
+            _mm_storeu_ps(out, _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)));
+            _mm_storeu_ps(out + 4, _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)));
+            _mm_storeu_ps(out + 8, _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)));
+            _mm_storeu_ps(out + 12, _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
+            return true;
+        }
+
+        // r = a.w * b + a.x * (-bx, bw, -bz, by) + a.y * (-by, bz, bw, -bx) + a.z * (-bz, -by, bx, bw)
+        QV_SIMD_TARGET("sse2")
+        inline void quaternionMultiplyFloatSse(const float* a, const float* b, float* out, size_t count) {
+            const __m128 signX = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+            const __m128 signY = _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+            const __m128 signZ = _mm_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+            for (size_t i = 0; i < count; ++i, a += 4, b += 4, out += 4) {
+                __m128 q = _mm_loadu_ps(b);
+                __m128 qx = _mm_xor_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(2, 3, 0, 1)), signX);
+                __m128 qy = _mm_xor_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(1, 0, 3, 2)), signY);
+                __m128 qz = _mm_xor_ps(_mm_shuffle_ps(q, q, _MM_SHUFFLE(0, 1, 2, 3)), signZ);
+                __m128 r = _mm_mul_ps(_mm_set1_ps(a[0]), q);
+                r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[1]), qx));
+                r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[2]), qy));
+                r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[3]), qz));
+                _mm_storeu_ps(out, r);
+            }
+        }
+
+        // ---------- float, AVX2 + FMA: dua baris sekaligus per register 256-bit ----------
+        QV_SIMD_TARGET("avx2,fma")
+        inline void multiplyFloatAvx2(const float* a, const float* b, float* out) {
+            __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b));
+            __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 4));
+            __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 8));
+            __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 12));
+            __m256 rowsLow = _mm256_loadu_ps(a);
+            __m256 rowsHigh = _mm256_loadu_ps(a + 8);
+
+            __m256 r = _mm256_mul_ps(_mm256_permute_ps(rowsLow, 0x00), b0);
+            r = _mm256_fmadd_ps(_mm256_permute_ps(rowsLow, 0x55), b1, r);
+            r = _mm256_fmadd_ps(_mm256_permute_ps(rowsLow, 0xAA), b2, r);
+            r = _mm256_fmadd_ps(_mm256_permute_ps(rowsLow, 0xFF), b3, r);
+
+            __m256 s = _mm256_mul_ps(_mm256_permute_ps(rowsHigh, 0x00), b0);
+            s = _mm256_fmadd_ps(_mm256_permute_ps(rowsHigh, 0x55), b1, s);
+            s = _mm256_fmadd_ps(_mm256_permute_ps(rowsHigh, 0xAA), b2, s);
+            s = _mm256_fmadd_ps(_mm256_permute_ps(rowsHigh, 0xFF), b3, s);
+
+            _mm256_storeu_ps(out, r);
+            _mm256_storeu_ps(out + 8, s);
+        }
+
+        // dua vektor per iterasi; kolom matriks diduplikasi di kedua lane 128-bit
+        QV_SIMD_TARGET("avx2,fma")
+        inline void transformVectorsFloatAvx2(const float* m, const float* in, float* out, size_t count) {
+            __m128 c0 = _mm_loadu_ps(m);
+            __m128 c1 = _mm_loadu_ps(m + 4);
+            __m128 c2 = _mm_loadu_ps(m + 8);
+            __m128 c3 = _mm_loadu_ps(m + 12);
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+            __m256 k0 = _mm256_insertf128_ps(_mm256_castps128_ps256(c0), c0, 1);
+            __m256 k1 = _mm256_insertf128_ps(_mm256_castps128_ps256(c1), c1, 1);
+            __m256 k2 = _mm256_insertf128_ps(_mm256_castps128_ps256(c2), c2, 1);
+            __m256 k3 = _mm256_insertf128_ps(_mm256_castps128_ps256(c3), c3, 1);
+
+            size_t i = 0;
+            for (; i + 2 <= count; i += 2, in += 8, out += 8) {
+                __m256 v = _mm256_loadu_ps(in);
+                __m256 r = _mm256_mul_ps(k0, _mm256_permute_ps(v, 0x00));
+                r = _mm256_fmadd_ps(k1, _mm256_permute_ps(v, 0x55), r);
+                r = _mm256_fmadd_ps(k2, _mm256_permute_ps(v, 0xAA), r);
+                r = _mm256_fmadd_ps(k3, _mm256_permute_ps(v, 0xFF), r);
+                _mm256_storeu_ps(out, r);
+            }
+            if (i < count) {
+                __m128 r = _mm_mul_ps(c0, _mm_set1_ps(in[0]));
+                r = _mm_fmadd_ps(c1, _mm_set1_ps(in[1]), r);
+                r = _mm_fmadd_ps(c2, _mm_set1_ps(in[2]), r);
+                r = _mm_fmadd_ps(c3, _mm_set1_ps(in[3]), r);
+                _mm_storeu_ps(out, r);
+            }
+        }
+
+        // ---------- double, AVX2 + FMA: satu baris per register ----------
+        QV_SIMD_TARGET("avx2,fma")
+        inline void multiplyDoubleAvx2(const double* a, const double* b, double* out) {
+            __m256d b0 = _mm256_loadu_pd(b);
+            __m256d b1 = _mm256_loadu_pd(b + 4);
+            __m256d b2 = _mm256_loadu_pd(b + 8);
+            __m256d b3 = _mm256_loadu_pd(b + 12);
+            __m256d rows[4];
+            for (int i = 0; i < 4; ++i) {
+                const double* row = a + i * 4;
+                __m256d r = _mm256_mul_pd(_mm256_broadcast_sd(row), b0);
+                r = _mm256_fmadd_pd(_mm256_broadcast_sd(row + 1), b1, r);
+                r = _mm256_fmadd_pd(_mm256_broadcast_sd(row + 2), b2, r);
+                rows[i] = _mm256_fmadd_pd(_mm256_broadcast_sd(row + 3), b3, r);
+            }
+            for (int i = 0; i < 4; ++i) {
+                _mm256_storeu_pd(out + i * 4, rows[i]);
+            }
+        }
+
+        QV_SIMD_TARGET("avx2,fma")
+        inline void transformVectorsDoubleAvx2(const double* m, const double* in, double* out, size_t count) {
+            // kolom matriks (row-major -> ambil per kolom sekali di depan)
+            __m256d c0 = _mm256_setr_pd(m[0], m[4], m[8], m[12]);
+            __m256d c1 = _mm256_setr_pd(m[1], m[5], m[9], m[13]);
+            __m256d c2 = _mm256_setr_pd(m[2], m[6], m[10], m[14]);
+            __m256d c3 = _mm256_setr_pd(m[3], m[7], m[11], m[15]);
+            for (size_t i = 0; i < count; ++i, in += 4, out += 4) {
+                __m256d r = _mm256_mul_pd(c0, _mm256_broadcast_sd(in));
+                r = _mm256_fmadd_pd(c1, _mm256_broadcast_sd(in + 1), r);
+                r = _mm256_fmadd_pd(c2, _mm256_broadcast_sd(in + 2), r);
+                r = _mm256_fmadd_pd(c3, _mm256_broadcast_sd(in + 3), r);
+                _mm256_storeu_pd(out, r);
+            }
+        }
+
+        // dua quaternion per iterasi, satu per lane 128-bit (permute_ps nggak nyebrang lane)
+        QV_SIMD_TARGET("avx2,fma")
+        inline void quaternionMultiplyFloatAvx2(const float* a, const float* b, float* out, size_t count) {
+            const __m256 signX = _mm256_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f);
+            const __m256 signY = _mm256_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f, -0.0f, 0.0f, 0.0f, -0.0f);
+            const __m256 signZ = _mm256_setr_ps(-0.0f, -0.0f, 0.0f, 0.0f, -0.0f, -0.0f, 0.0f, 0.0f);
+            size_t i = 0;
+            for (; i + 2 <= count; i += 2, a += 8, b += 8, out += 8) {
+                __m256 p = _mm256_loadu_ps(a);
+                __m256 q = _mm256_loadu_ps(b);
+                __m256 qx = _mm256_xor_ps(_mm256_permute_ps(q, _MM_SHUFFLE(2, 3, 0, 1)), signX);
+                __m256 qy = _mm256_xor_ps(_mm256_permute_ps(q, _MM_SHUFFLE(1, 0, 3, 2)), signY);
+                __m256 qz = _mm256_xor_ps(_mm256_permute_ps(q, _MM_SHUFFLE(0, 1, 2, 3)), signZ);
+                __m256 r = _mm256_mul_ps(_mm256_permute_ps(p, 0x00), q);
+                r = _mm256_fmadd_ps(_mm256_permute_ps(p, 0x55), qx, r);
+                r = _mm256_fmadd_ps(_mm256_permute_ps(p, 0xAA), qy, r);
+                r = _mm256_fmadd_ps(_mm256_permute_ps(p, 0xFF), qz, r);
+                _mm256_storeu_ps(out, r);
+            }
+            if (i < count) {
+                quaternionMultiplyFloatSse(a, b, out, 1);
+            }
+        }
+
+        QV_SIMD_TARGET("avx2,fma")
+        inline void quaternionMultiplyDoubleAvx2(const double* a, const double* b, double* out, size_t count) {
+            const __m256d signX = _mm256_setr_pd(-0.0, 0.0, -0.0, 0.0);
+            const __m256d signY = _mm256_setr_pd(-0.0, 0.0, 0.0, -0.0);
+            const __m256d signZ = _mm256_setr_pd(-0.0, -0.0, 0.0, 0.0);
+            for (size_t i = 0; i < count; ++i, a += 4, b += 4, out += 4) {
+                __m256d q = _mm256_loadu_pd(b);
+                __m256d qx = _mm256_xor_pd(_mm256_permute_pd(q, 0x5), signX);
+                __m256d qy = _mm256_xor_pd(_mm256_permute4x64_pd(q, _MM_SHUFFLE(1, 0, 3, 2)), signY);
+                __m256d qz = _mm256_xor_pd(_mm256_permute4x64_pd(q, _MM_SHUFFLE(0, 1, 2, 3)), signZ);
+                __m256d r = _mm256_mul_pd(_mm256_broadcast_sd(a), q);
+                r = _mm256_fmadd_pd(_mm256_broadcast_sd(a + 1), qx, r);
+                r = _mm256_fmadd_pd(_mm256_broadcast_sd(a + 2), qy, r);
+                r = _mm256_fmadd_pd(_mm256_broadcast_sd(a + 3), qz, r);
+                _mm256_storeu_pd(out, r);
+            }
+        }
+
+        // ---------- batch SoA ----------
+        // template lane AVX dipakai dari fungsi yang belum ber-target sebelum di-flatten; peringatan ABI-nya nggak relevan
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+        // kernel SoA cuma beda lebar register antar ISA, jadi ditulis sekali di atas "lanes" ini.
+        // Template-nya sendiri tanpa atribut target; instance per ISA dibungkus fungsi ber-target + flatten
+        // (QV_SIMD_BATCH_KERNELS di bawah) supaya semua operasi lane ke-inline dengan ISA yang benar
+        struct Sse2Float {
+            using Scalar = float;
+            using Reg = __m128;
+            static constexpr size_t WIDTH = 4;
+            QV_SIMD_TARGET("sse2") static Reg load(const float* p) { return _mm_loadu_ps(p); }
+            QV_SIMD_TARGET("sse2") static void store(float* p, Reg v) { _mm_storeu_ps(p, v); }
+            QV_SIMD_TARGET("sse2") static Reg set1(float v) { return _mm_set1_ps(v); }
+            QV_SIMD_TARGET("sse2") static Reg add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg div(Reg a, Reg b) { return _mm_div_ps(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg sqrt(Reg a) { return _mm_sqrt_ps(a); }
+            QV_SIMD_TARGET("sse2") static Reg fmadd(Reg a, Reg b, Reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+            // mask ? a : b
+            QV_SIMD_TARGET("sse2") static Reg isZero(Reg a) { return _mm_cmpeq_ps(a, _mm_setzero_ps()); }
+            QV_SIMD_TARGET("sse2") static Reg select(Reg mask, Reg a, Reg b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+            QV_SIMD_TARGET("sse2") static Reg abs(Reg a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+            QV_SIMD_TARGET("sse2") static Reg min(Reg a, Reg b) { return _mm_min_ps(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg max(Reg a, Reg b) { return _mm_max_ps(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg lessThan(Reg a, Reg b) { return _mm_cmplt_ps(a, b); }
+        };
+        struct Sse2Double {
+            using Scalar = double;
+            using Reg = __m128d;
+            static constexpr size_t WIDTH = 2;
+            QV_SIMD_TARGET("sse2") static Reg load(const double* p) { return _mm_loadu_pd(p); }
+            QV_SIMD_TARGET("sse2") static void store(double* p, Reg v) { _mm_storeu_pd(p, v); }
+            QV_SIMD_TARGET("sse2") static Reg set1(double v) { return _mm_set1_pd(v); }
+            QV_SIMD_TARGET("sse2") static Reg add(Reg a, Reg b) { return _mm_add_pd(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg sub(Reg a, Reg b) { return _mm_sub_pd(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg mul(Reg a, Reg b) { return _mm_mul_pd(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg div(Reg a, Reg b) { return _mm_div_pd(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg sqrt(Reg a) { return _mm_sqrt_pd(a); }
+            QV_SIMD_TARGET("sse2") static Reg fmadd(Reg a, Reg b, Reg c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+            QV_SIMD_TARGET("sse2") static Reg isZero(Reg a) { return _mm_cmpeq_pd(a, _mm_setzero_pd()); }
+            QV_SIMD_TARGET("sse2") static Reg select(Reg mask, Reg a, Reg b) { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+            QV_SIMD_TARGET("sse2") static Reg abs(Reg a) { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+            QV_SIMD_TARGET("sse2") static Reg min(Reg a, Reg b) { return _mm_min_pd(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg max(Reg a, Reg b) { return _mm_max_pd(a, b); }
+            QV_SIMD_TARGET("sse2") static Reg lessThan(Reg a, Reg b) { return _mm_cmplt_pd(a, b); }
+        };
+        struct Avx2Float {
+            using Scalar = float;
+            using Reg = __m256;
+            static constexpr size_t WIDTH = 8;
+            QV_SIMD_TARGET("avx2,fma") static Reg load(const float* p) { return _mm256_loadu_ps(p); }
+            QV_SIMD_TARGET("avx2,fma") static void store(float* p, Reg v) { _mm256_storeu_ps(p, v); }
+            QV_SIMD_TARGET("avx2,fma") static Reg set1(float v) { return _mm256_set1_ps(v); }
+            QV_SIMD_TARGET("avx2,fma") static Reg add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg sub(Reg a, Reg b) { return _mm256_sub_ps(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg div(Reg a, Reg b) { return _mm256_div_ps(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg sqrt(Reg a) { return _mm256_sqrt_ps(a); }
+            QV_SIMD_TARGET("avx2,fma") static Reg fmadd(Reg a, Reg b, Reg c) { return _mm256_fmadd_ps(a, b, c); }
+            QV_SIMD_TARGET("avx2,fma") static Reg isZero(Reg a) { return _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ); }
+            QV_SIMD_TARGET("avx2,fma") static Reg select(Reg mask, Reg a, Reg b) { return _mm256_blendv_ps(b, a, mask); }
+            QV_SIMD_TARGET("avx2,fma") static Reg abs(Reg a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+            QV_SIMD_TARGET("avx2,fma") static Reg min(Reg a, Reg b) { return _mm256_min_ps(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg max(Reg a, Reg b) { return _mm256_max_ps(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg lessThan(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        };
+        struct Avx2Double {
+            using Scalar = double;
+            using Reg = __m256d;
+            static constexpr size_t WIDTH = 4;
+            QV_SIMD_TARGET("avx2,fma") static Reg load(const double* p) { return _mm256_loadu_pd(p); }
+            QV_SIMD_TARGET("avx2,fma") static void store(double* p, Reg v) { _mm256_storeu_pd(p, v); }
+            QV_SIMD_TARGET("avx2,fma") static Reg set1(double v) { return _mm256_set1_pd(v); }
+            QV_SIMD_TARGET("avx2,fma") static Reg add(Reg a, Reg b) { return _mm256_add_pd(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg sub(Reg a, Reg b) { return _mm256_sub_pd(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg mul(Reg a, Reg b) { return _mm256_mul_pd(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg div(Reg a, Reg b) { return _mm256_div_pd(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg sqrt(Reg a) { return _mm256_sqrt_pd(a); }
+            QV_SIMD_TARGET("avx2,fma") static Reg fmadd(Reg a, Reg b, Reg c) { return _mm256_fmadd_pd(a, b, c); }
+            QV_SIMD_TARGET("avx2,fma") static Reg isZero(Reg a) { return _mm256_cmp_pd(a, _mm256_setzero_pd(), _CMP_EQ_OQ); }
+            QV_SIMD_TARGET("avx2,fma") static Reg select(Reg mask, Reg a, Reg b) { return _mm256_blendv_pd(b, a, mask); }
+            QV_SIMD_TARGET("avx2,fma") static Reg abs(Reg a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+            QV_SIMD_TARGET("avx2,fma") static Reg min(Reg a, Reg b) { return _mm256_min_pd(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg max(Reg a, Reg b) { return _mm256_max_pd(a, b); }
+            QV_SIMD_TARGET("avx2,fma") static Reg lessThan(Reg a, Reg b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+        };
+
+        // v' = v + w t + u x t, t = 2u x v (u = bagian vektor quaternion unit)
+        template<typename L>
+        struct RotateStep {
+            using Reg = typename L::Reg;
+            static void apply(Reg w, Reg ux, Reg uy, Reg uz, Reg twoUx, Reg twoUy, Reg twoUz,
+                              Reg vx, Reg vy, Reg vz, Reg& rx, Reg& ry, Reg& rz) {
+                Reg tx = L::sub(L::mul(twoUy, vz), L::mul(twoUz, vy));
+                Reg ty = L::sub(L::mul(twoUz, vx), L::mul(twoUx, vz));
+                Reg tz = L::sub(L::mul(twoUx, vy), L::mul(twoUy, vx));
+                rx = L::add(L::fmadd(w, tx, vx), L::sub(L::mul(uy, tz), L::mul(uz, ty)));
+                ry = L::add(L::fmadd(w, ty, vy), L::sub(L::mul(uz, tx), L::mul(ux, tz)));
+                rz = L::add(L::fmadd(w, tz, vz), L::sub(L::mul(ux, ty), L::mul(uy, tx)));
+            }
+        };
+
+        template<typename L>
+        size_t rotateSoa(const typename L::Scalar* q, Vector3View<const typename L::Scalar> in,
+                         Vector3View<typename L::Scalar> out, size_t count) {
+            using Reg = typename L::Reg;
+            const Reg two = L::set1(2);
+            const Reg w = L::set1(q[0]);
+            const Reg ux = L::set1(q[1]), uy = L::set1(q[2]), uz = L::set1(q[3]);
+            const Reg twoUx = L::mul(two, ux), twoUy = L::mul(two, uy), twoUz = L::mul(two, uz);
+            size_t i = 0;
+            for (; i + L::WIDTH <= count; i += L::WIDTH) {
+                Reg rx, ry, rz;
+                RotateStep<L>::apply(w, ux, uy, uz, twoUx, twoUy, twoUz,
+                                     L::load(in.x + i), L::load(in.y + i), L::load(in.z + i), rx, ry, rz);
+                L::store(out.x + i, rx);
+                L::store(out.y + i, ry);
+                L::store(out.z + i, rz);
+            }
+            return i;
+        }
+
+        template<typename L>
+        size_t rotateEachSoa(QuaternionView<const typename L::Scalar> q, Vector3View<const typename L::Scalar> in,
+                             Vector3View<typename L::Scalar> out, size_t count) {
+            using Reg = typename L::Reg;
+            const Reg two = L::set1(2);
+            size_t i = 0;
+            for (; i + L::WIDTH <= count; i += L::WIDTH) {
+                Reg ux = L::load(q.x + i), uy = L::load(q.y + i), uz = L::load(q.z + i);
+                Reg rx, ry, rz;
+                RotateStep<L>::apply(L::load(q.w + i), ux, uy, uz, L::mul(two, ux), L::mul(two, uy), L::mul(two, uz),
+                                     L::load(in.x + i), L::load(in.y + i), L::load(in.z + i), rx, ry, rz);
+                L::store(out.x + i, rx);
+                L::store(out.y + i, ry);
+                L::store(out.z + i, rz);
+            }
+            return i;
+        }
+
+        template<typename L>
+        size_t normalizeSoa(QuaternionView<typename L::Scalar> q, size_t count) {
+            using Reg = typename L::Reg;
+            const Reg one = L::set1(1);
+            const Reg zero = L::set1(0);
+            size_t i = 0;
+            for (; i + L::WIDTH <= count; i += L::WIDTH) {
+                Reg w = L::load(q.w + i), x = L::load(q.x + i), y = L::load(q.y + i), z = L::load(q.z + i);
+                Reg lengthSquared = L::fmadd(w, w, L::fmadd(x, x, L::fmadd(y, y, L::mul(z, z))));
+                Reg degenerate = L::isZero(lengthSquared);
+                // sqrt + div biasa (bukan rsqrt) supaya hasilnya sama dengan Quaternion::normalize
+                Reg inverseLength = L::select(degenerate, zero, L::div(one, L::sqrt(lengthSquared)));
+                L::store(q.w + i, L::select(degenerate, one, L::mul(w, inverseLength)));
+                L::store(q.x + i, L::mul(x, inverseLength));
+                L::store(q.y + i, L::mul(y, inverseLength));
+                L::store(q.z + i, L::mul(z, inverseLength));
+            }
+            return i;
+        }
+
+        template<typename L>
+        size_t alignmentSumsSoa(Vector3View<const typename L::Scalar> source, Vector3View<const typename L::Scalar> target,
+                                const typename L::Scalar* origin, size_t count, typename L::Scalar* sums) {
+            using Reg = typename L::Reg;
+            using Scalar = typename L::Scalar;
+            const Reg originA[3] = {L::set1(origin[0]), L::set1(origin[1]), L::set1(origin[2])};
+            const Reg originB[3] = {L::set1(origin[3]), L::set1(origin[4]), L::set1(origin[5])};
+            Reg acc[ALIGNMENT_SUM_COUNT];
+            for (size_t k = 0; k < ALIGNMENT_SUM_COUNT; ++k) acc[k] = L::set1(0);
+
+            size_t i = 0;
+            for (; i + L::WIDTH <= count; i += L::WIDTH) {
+                const Reg a[3] = {L::sub(L::load(source.x + i), originA[0]), L::sub(L::load(source.y + i), originA[1]),
+                                  L::sub(L::load(source.z + i), originA[2])};
+                const Reg b[3] = {L::sub(L::load(target.x + i), originB[0]), L::sub(L::load(target.y + i), originB[1]),
+                                  L::sub(L::load(target.z + i), originB[2])};
+                for (int r = 0; r < 3; ++r) {
+                    acc[r] = L::add(acc[r], a[r]);
+                    acc[3 + r] = L::add(acc[3 + r], b[r]);
+                    for (int c = 0; c < 3; ++c) {
+                        acc[6 + r * 3 + c] = L::fmadd(a[r], b[c], acc[6 + r * 3 + c]);
+                    }
+                    acc[15] = L::fmadd(a[r], a[r], acc[15]);
+                    acc[16] = L::fmadd(b[r], b[r], acc[16]);
+                }
+            }
+
+            Scalar lanes[L::WIDTH];
+            for (size_t k = 0; k < ALIGNMENT_SUM_COUNT; ++k) {
+                L::store(lanes, acc[k]);
+                Scalar total = 0;
+                for (size_t lane = 0; lane < L::WIDTH; ++lane) total += lanes[lane];
+                sums[k] = total;
+            }
+            return i;
+        }
+
+#define QV_SIMD_ALIGNMENT_KERNELS(Lanes, isa, suffix)                                                          \
+        QV_SIMD_TARGET(isa) __attribute__((flatten))                                                           \
+        inline size_t alignmentSums##suffix(Vector3View<const Lanes::Scalar> source,                           \
+                                            Vector3View<const Lanes::Scalar> target,                           \
+                                            const Lanes::Scalar* origin, size_t count, Lanes::Scalar* sums) {  \
+            return alignmentSumsSoa<Lanes>(source, target, origin, count, sums);                               \
+        }
+
+        QV_SIMD_ALIGNMENT_KERNELS(Sse2Float, "sse2", FloatSse)
+        QV_SIMD_ALIGNMENT_KERNELS(Sse2Double, "sse2", DoubleSse)
+        QV_SIMD_ALIGNMENT_KERNELS(Avx2Float, "avx2,fma", FloatAvx2)
+        QV_SIMD_ALIGNMENT_KERNELS(Avx2Double, "avx2,fma", DoubleAvx2)
+#undef QV_SIMD_ALIGNMENT_KERNELS
+
+#define QV_SIMD_TRIG_KERNELS(Lanes, isa, suffix)                                                               \
+        QV_SIMD_TARGET(isa) __attribute__((flatten))                                                           \
+        inline size_t sincos##suffix(const Lanes::Scalar* angles, Lanes::Scalar* sines, Lanes::Scalar* cosines, \
+                                     size_t count) {                                                           \
+            return sincosSoa<Lanes>(angles, sines, cosines, count);                                            \
+        }                                                                                                      \
+        QV_SIMD_TARGET(isa) __attribute__((flatten))                                                           \
+        inline size_t atan2##suffix(const Lanes::Scalar* y, const Lanes::Scalar* x, Lanes::Scalar* out,         \
+                                    size_t count) {                                                            \
+            return atan2Soa<Lanes>(y, x, out, count);                                                          \
+        }
+
+        QV_SIMD_TRIG_KERNELS(Sse2Float, "sse2", FloatSse)
+        QV_SIMD_TRIG_KERNELS(Sse2Double, "sse2", DoubleSse)
+        QV_SIMD_TRIG_KERNELS(Avx2Float, "avx2,fma", FloatAvx2)
+        QV_SIMD_TRIG_KERNELS(Avx2Double, "avx2,fma", DoubleAvx2)
+#undef QV_SIMD_TRIG_KERNELS
+
+#define QV_SIMD_BATCH_KERNELS(Lanes, isa, suffix)                                                              \
+        QV_SIMD_TARGET(isa) __attribute__((flatten))                                                           \
+        inline size_t rotate##suffix(const Lanes::Scalar* q, Vector3View<const Lanes::Scalar> in,              \
+                                     Vector3View<Lanes::Scalar> out, size_t count) {                           \
+            return rotateSoa<Lanes>(q, in, out, count);                                                        \
+        }                                                                                                      \
+        QV_SIMD_TARGET(isa) __attribute__((flatten))                                                           \
+        inline size_t rotateEach##suffix(QuaternionView<const Lanes::Scalar> q, Vector3View<const Lanes::Scalar> in, \
+                                         Vector3View<Lanes::Scalar> out, size_t count) {                       \
+            return rotateEachSoa<Lanes>(q, in, out, count);                                                    \
+        }                                                                                                      \
+        QV_SIMD_TARGET(isa) __attribute__((flatten))                                                           \
+        inline size_t normalize##suffix(QuaternionView<Lanes::Scalar> q, size_t count) {                      \
+            return normalizeSoa<Lanes>(q, count);                                                              \
+        }
+
+        QV_SIMD_BATCH_KERNELS(Sse2Float, "sse2", FloatSse)
+        QV_SIMD_BATCH_KERNELS(Sse2Double, "sse2", DoubleSse)
+        QV_SIMD_BATCH_KERNELS(Avx2Float, "avx2,fma", FloatAvx2)
+        QV_SIMD_BATCH_KERNELS(Avx2Double, "avx2,fma", DoubleAvx2)
+#undef QV_SIMD_BATCH_KERNELS
+#pragma GCC diagnostic pop
+
+        inline bool cpuHasAvx2Fma() {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        }
+    } // namespace detail
+#endif
+
+    // kandidat kernel, dari yang paling cepat; primary template = tipe tanpa kernel SIMD
+    template<typename T>
+    inline std::vector<MatrixKernels<T>> matrixKernelCandidates() {
+        return {};
+    }
+
+    template<typename T>
+    inline std::vector<QuaternionKernels<T>> quaternionKernelCandidates() {
+        return {};
+    }
+
+    template<typename T>
+    inline std::vector<QuaternionBatchKernels<T>> quaternionBatchKernelCandidates() {
+        return {};
+    }
+
+    template<typename T>
+    inline std::vector<TrigKernels<T>> trigKernelCandidates() {
+        return {};
+    }
+
+    template<typename T>
+    inline std::vector<AlignmentKernels<T>> alignmentKernelCandidates() {
+        return {};
+    }
+
+#ifdef QV_SIMD_X86
+    template<>
+    inline std::vector<MatrixKernels<float>> matrixKernelCandidates<float>() {
+        std::vector<MatrixKernels<float>> candidates;
+        if (detail::cpuHasAvx2Fma()) {
+            candidates.push_back({detail::multiplyFloatAvx2, detail::transformVectorsFloatAvx2, detail::inverseFloatSse, "avx2+fma"});
+        }
+        candidates.push_back({detail::multiplyFloatSse, detail::transformVectorsFloatSse, detail::inverseFloatSse, "sse2"});
+        return candidates;
+    }
+
+    // invers double tetap lewat kofaktor skalar (compiler sudah vektorisasi cukup baik di sana)
+    template<>
+    inline std::vector<MatrixKernels<double>> matrixKernelCandidates<double>() {
+        std::vector<MatrixKernels<double>> candidates;
+        if (detail::cpuHasAvx2Fma()) {
+            candidates.push_back({detail::multiplyDoubleAvx2, detail::transformVectorsDoubleAvx2, nullptr, "avx2+fma"});
+        }
+        return candidates;
+    }
+
+    template<>
+    inline std::vector<QuaternionKernels<float>> quaternionKernelCandidates<float>() {
+        // versi SSE2 (satu quaternion per iterasi) kalah dari loop skalar yang sudah divektorisasi compiler,
+        // jadi tanpa AVX2 tetap skalar
+        std::vector<QuaternionKernels<float>> candidates;
+        if (detail::cpuHasAvx2Fma()) {
+            candidates.push_back({detail::quaternionMultiplyFloatAvx2, "avx2+fma"});
+        }
+        return candidates;
+    }
+
+    template<>
+    inline std::vector<QuaternionKernels<double>> quaternionKernelCandidates<double>() {
+        std::vector<QuaternionKernels<double>> candidates;
+        if (detail::cpuHasAvx2Fma()) {
+            candidates.push_back({detail::quaternionMultiplyDoubleAvx2, "avx2+fma"});
+        }
+        return candidates;
+    }
+
+    template<>
+    inline std::vector<QuaternionBatchKernels<float>> quaternionBatchKernelCandidates<float>() {
+        std::vector<QuaternionBatchKernels<float>> candidates;
+        if (detail::cpuHasAvx2Fma()) {
+            candidates.push_back({detail::rotateFloatAvx2, detail::rotateEachFloatAvx2, detail::normalizeFloatAvx2, "avx2+fma"});
+        }
+        candidates.push_back({detail::rotateFloatSse, detail::rotateEachFloatSse, detail::normalizeFloatSse, "sse2"});
+        return candidates;
+    }
+
+    template<>
+    inline std::vector<QuaternionBatchKernels<double>> quaternionBatchKernelCandidates<double>() {
+        std::vector<QuaternionBatchKernels<double>> candidates;
+        if (detail::cpuHasAvx2Fma()) {
+            candidates.push_back({detail::rotateDoubleAvx2, detail::rotateEachDoubleAvx2, detail::normalizeDoubleAvx2, "avx2+fma"});
+        }
+        candidates.push_back({detail::rotateDoubleSse, detail::rotateEachDoubleSse, detail::normalizeDoubleSse, "sse2"});
+        return candidates;
+    }
+
+    template<>
+    inline std::vector<TrigKernels<float>> trigKernelCandidates<float>() {
+        std::vector<TrigKernels<float>> candidates;
+        if (detail::cpuHasAvx2Fma()) {
+            candidates.push_back({detail::sincosFloatAvx2, detail::atan2FloatAvx2, "avx2+fma"});
+        }
+        candidates.push_back({detail::sincosFloatSse, detail::atan2FloatSse, "sse2"});
+        return candidates;
+    }
+
+    template<>
+    inline std::vector<TrigKernels<double>> trigKernelCandidates<double>() {
+        std::vector<TrigKernels<double>> candidates;
+        if (detail::cpuHasAvx2Fma()) {
+            candidates.push_back({detail::sincosDoubleAvx2, detail::atan2DoubleAvx2, "avx2+fma"});
+        }
+        candidates.push_back({detail::sincosDoubleSse, detail::atan2DoubleSse, "sse2"});
+        return candidates;
+    }
+
+    template<>
+    inline std::vector<AlignmentKernels<float>> alignmentKernelCandidates<float>() {
+        std::vector<AlignmentKernels<float>> candidates;
+        if (detail::cpuHasAvx2Fma()) {
+            candidates.push_back({detail::alignmentSumsFloatAvx2, "avx2+fma"});
+        }
+        candidates.push_back({detail::alignmentSumsFloatSse, "sse2"});
+        return candidates;
+    }
+
+    template<>
+    inline std::vector<AlignmentKernels<double>> alignmentKernelCandidates<double>() {
+        std::vector<AlignmentKernels<double>> candidates;
+        if (detail::cpuHasAvx2Fma()) {
+            candidates.push_back({detail::alignmentSumsDoubleAvx2, "avx2+fma"});
+        }
+        candidates.push_back({detail::alignmentSumsDoubleSse, "sse2"});
+        return candidates;
+    }
+#endif
+
+} // namespace simd
+} // namespace math
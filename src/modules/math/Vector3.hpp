@@ -1,34 +1,30 @@
 #pragma once
 #include <cmath>
+#include "VectorExpression.hpp"
 
 namespace math {
     template<typename T>
-    class Vector3 {
+    class Vector3 : public VectorExpression<Vector3<T>, T, 3> {
     public:
         T x, y, z;
 
         // ctor
         Vector3() : x(static_cast<T>(0)), y(static_cast<T>(0)), z(static_cast<T>(0)) {}
         Vector3(T x, T y, T z) : x(x), y(y), z(z) {}
+        // evaluasi ekspresi (a + b * s ...) sekaligus, tanpa Vector3 perantara
+        template<typename E>
+        Vector3(const VectorExpression<E, T, 3>& expression)
+            : x(expression.derived().template component<0>()),
+              y(expression.derived().template component<1>()),
+              z(expression.derived().template component<2>()) {}
 
-        // operator overloading
-        Vector3 operator+(const Vector3& other) const {
-            return Vector3(x + other.x, y + other.y, z + other.z);
-        }
-        Vector3 operator-(const Vector3& other) const {
-            return Vector3(x - other.x, y - other.y, z - other.z);
-        }
-        Vector3 operator*(T scalar) const {
-            return Vector3(x * scalar, y * scalar, z * scalar);
-        }
-        Vector3 operator/(T scalar) const {
-            if (scalar == static_cast<T>(0)) {
-                return Vector3();
-            }
-            T invScalar = static_cast<T>(1) / scalar;
-            return Vector3(x * invScalar, y * invScalar, z * invScalar);
+        template<size_t I> T component() const {
+            static_assert(I < 3, "Vector3 cuma punya 3 komponen");
+            return I == 0 ? x : (I == 1 ? y : z);
         }
 
+        // operator +, -, * dan / ada di VectorExpression.hpp (lazy)
+
         bool operator==(const Vector3& other) const {
             return x == other.x && y == other.y && z == other.z;
         }
@@ -54,7 +50,7 @@ namespace math {
             if (len == static_cast<T>(0)) {
                 return Vector3();
             }
-            return (*this) / len;
+            return divideUnchecked(*this, len);
         }
 
     };
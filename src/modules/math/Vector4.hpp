@@ -4,10 +4,11 @@
 #include <cmath>
 
 #include "Vector3.hpp"
+#include "VectorExpression.hpp"
 
 namespace math {
     template<typename T>
-    class Vector4 {
+    class Vector4 : public VectorExpression<Vector4<T>, T, 4> {
     public:
         // ctor
         Vector4() : data{static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)} {}
@@ -15,6 +16,16 @@ namespace math {
         
         // ctor buat ngubah ke koordinat homogen
         explicit Vector4(const Vector3<T>& v, T w) : data{v.x, v.y, v.z, w} {}
+        // evaluasi ekspresi sekaligus, tanpa Vector4 perantara
+        template<typename E>
+        Vector4(const VectorExpression<E, T, 4>& expression)
+            : data{expression.derived().template component<0>(), expression.derived().template component<1>(),
+                   expression.derived().template component<2>(), expression.derived().template component<3>()} {}
+
+        template<size_t I> T component() const {
+            static_assert(I < 4, "Vector4 cuma punya 4 komponen");
+            return data[I];
+        }
 
         // Akses komponen
         T& x() { return data[0]; }
@@ -26,31 +37,7 @@ namespace math {
         T& w() { return data[3]; }
         const T& w() const { return data[3]; }
 
-        // operator overloading
-        Vector4 operator+(const Vector4& other) const {
-            return Vector4(
-                data[0] + other.data[0],
-                data[1] + other.data[1],
-                data[2] + other.data[2],
-                data[3] + other.data[3]
-            );
-        }
-        Vector4 operator-(const Vector4& other) const {
-            return Vector4(
-                data[0] - other.data[0],
-                data[1] - other.data[1],
-                data[2] - other.data[2],
-                data[3] - other.data[3]
-            );
-        }
-        Vector4 operator*(T scalar) const {
-            return Vector4(
-                data[0] * scalar,
-                data[1] * scalar,
-                data[2] * scalar,
-                data[3] * scalar
-            );
-        }
+        // operator +, -, * dan / ada di VectorExpression.hpp (lazy)
 
     private:
         std::array<T, 4> data;
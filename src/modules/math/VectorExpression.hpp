@@ -0,0 +1,117 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+// Expression template buat Vector3/Vector4: a + b * s - c nggak bikin Vector3 sementara di tiap langkah,
+// tapi jadi satu pohon tipe yang baru dievaluasi per komponen waktu di-assign ke Vector3/Vector4.
+// Operand disimpan by value (cuma 3-4 angka), jadi `auto e = f() + v;` tetap aman walau f() temporary
+namespace math {
+    template<typename T> class Vector3;
+    template<typename T> class Vector4;
+
+    template<typename Derived, typename T, size_t N>
+    struct VectorExpression {
+        using ValueType = T;
+        static constexpr size_t SIZE = N;
+        using ResultType = typename std::conditional<N == 3, Vector3<T>, Vector4<T>>::type;
+
+        const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+        ResultType eval() const { return ResultType(*this); }
+
+        // biar (a - b).normalize() dkk. tetap jalan
+        T length() const { return eval().length(); }
+        ResultType normalize() const { return eval().normalize(); }
+        T dot(const ResultType& other) const { return eval().dot(other); }
+        ResultType cross(const ResultType& other) const { return eval().cross(other); }
+    };
+
+    // scalar nggak ikut deduksi T, jadi v * 0.5 tetap jalan buat Vector3<float>
+    template<typename T>
+    struct NonDeduced { using Type = T; };
+
+    template<typename L, typename R, typename T, size_t N>
+    class VectorSum : public VectorExpression<VectorSum<L, R, T, N>, T, N> {
+    public:
+        VectorSum(const L& left, const R& right) : left(left), right(right) {}
+        template<size_t I> T component() const { return left.template component<I>() + right.template component<I>(); }
+    private:
+        L left;
+        R right;
+    };
+
+    template<typename L, typename R, typename T, size_t N>
+    class VectorDifference : public VectorExpression<VectorDifference<L, R, T, N>, T, N> {
+    public:
+        VectorDifference(const L& left, const R& right) : left(left), right(right) {}
+        template<size_t I> T component() const { return left.template component<I>() - right.template component<I>(); }
+    private:
+        L left;
+        R right;
+    };
+
+    template<typename E, typename T, size_t N>
+    class VectorNegation : public VectorExpression<VectorNegation<E, T, N>, T, N> {
+    public:
+        explicit VectorNegation(const E& operand) : operand(operand) {}
+        template<size_t I> T component() const { return -operand.template component<I>(); }
+    private:
+        E operand;
+    };
+
+    template<typename E, typename T, size_t N>
+    class VectorScaled : public VectorExpression<VectorScaled<E, T, N>, T, N> {
+    public:
+        VectorScaled(const E& operand, T factor) : operand(operand), factor(factor) {}
+        template<size_t I> T component() const { return operand.template component<I>() * factor; }
+        const E& getOperand() const { return operand; }
+        T getFactor() const { return factor; }
+    private:
+        E operand;
+        T factor;
+    };
+
+    template<typename L, typename R, typename T, size_t N>
+    VectorSum<L, R, T, N> operator+(const VectorExpression<L, T, N>& left, const VectorExpression<R, T, N>& right) {
+        return VectorSum<L, R, T, N>(left.derived(), right.derived());
+    }
+
+    template<typename L, typename R, typename T, size_t N>
+    VectorDifference<L, R, T, N> operator-(const VectorExpression<L, T, N>& left, const VectorExpression<R, T, N>& right) {
+        return VectorDifference<L, R, T, N>(left.derived(), right.derived());
+    }
+
+    template<typename E, typename T, size_t N>
+    VectorNegation<E, T, N> operator-(const VectorExpression<E, T, N>& operand) {
+        return VectorNegation<E, T, N>(operand.derived());
+    }
+
+    template<typename E, typename T, size_t N>
+    VectorScaled<E, T, N> operator*(const VectorExpression<E, T, N>& operand, typename NonDeduced<T>::Type scalar) {
+        return VectorScaled<E, T, N>(operand.derived(), scalar);
+    }
+    template<typename E, typename T, size_t N>
+    VectorScaled<E, T, N> operator*(typename NonDeduced<T>::Type scalar, const VectorExpression<E, T, N>& operand) {
+        return VectorScaled<E, T, N>(operand.derived(), scalar);
+    }
+    // (v * a) * b -> v * (a * b): satu perkalian per komponen, bukan dua
+    template<typename E, typename T, size_t N>
+    VectorScaled<E, T, N> operator*(const VectorScaled<E, T, N>& operand, typename NonDeduced<T>::Type scalar) {
+        return VectorScaled<E, T, N>(operand.getOperand(), operand.getFactor() * scalar);
+    }
+
+    // pembagian dengan nol -> vektor nol (perilaku lama Vector3::operator/);
+    // pengecekannya sekali per ekspresi, bukan per komponen
+    template<typename E, typename T, size_t N>
+    VectorScaled<E, T, N> operator/(const VectorExpression<E, T, N>& operand, typename NonDeduced<T>::Type scalar) {
+        T reciprocal = scalar == static_cast<T>(0) ? static_cast<T>(0) : static_cast<T>(1) / scalar;
+        return VectorScaled<E, T, N>(operand.derived(), reciprocal);
+    }
+
+    // tanpa cek nol sama sekali; pemanggil yang menjamin scalar != 0 (mis. panjang yang sudah dicek)
+    template<typename E, typename T, size_t N>
+    VectorScaled<E, T, N> divideUnchecked(const VectorExpression<E, T, N>& operand, typename NonDeduced<T>::Type scalar) {
+        return VectorScaled<E, T, N>(operand.derived(), static_cast<T>(1) / scalar);
+    }
+} // namespace math
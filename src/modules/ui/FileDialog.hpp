@@ -1,10 +1,17 @@
 #pragma once
 #include "UIComponent.hpp"
 #include "Button.hpp"
+#include "InputField.hpp"
+#include "FuzzyFilter.hpp"
+#include "../graphics/ModelIndex.hpp"
+#include "../graphics/ThumbnailCache.hpp"
 #include <vector>
 #include <string>
-#include <filesystem>
+#include <memory>
 #include <functional>
+#include <cstdio>
+#include <algorithm>
+#include <unordered_map>
 
 namespace ui {
     
@@ -12,18 +19,26 @@ namespace ui {
     public:
         using FileSelectedCallback = std::function<void(const std::string&)>;
         
-        FileDialog(const Rect& bounds, FileSelectedCallback onFileSelected = nullptr)
-            : UIComponent(bounds), onFileSelected(onFileSelected), 
-              selectedIndex(-1), scrollOffset(0) {
+        // daftar file diambil dari ModelIndex (di-scan di background), dialog nggak pernah baca disk sendiri
+        // thumbnail (opsional) dirender di worker pool; dialog cuma upload yang sudah jadi ke texture
+        FileDialog(const Rect& bounds, std::shared_ptr<graphics::ModelIndex> modelIndex,
+                   std::shared_ptr<graphics::ThumbnailCache> thumbnailCache = nullptr,
+                   FileSelectedCallback onFileSelected = nullptr)
+            : UIComponent(bounds), onFileSelected(onFileSelected), modelIndex(std::move(modelIndex)),
+              thumbnailCache(std::move(thumbnailCache)), selectedIndex(-1), scrollOffset(0), syncedVersion(0) {
             
             
             backgroundColor = Color(30, 30, 30, 240); 
             itemColor = Color(50, 50, 50, 255);
             selectedItemColor = Color(0, 120, 215, 255); 
             textColor = Color(255, 255, 255, 255);
+            detailColor = Color(150, 150, 150, 255);
             
             
-            refreshFileList();
+            filterInput = std::make_unique<InputField>(
+                Rect(bounds.x + 10, bounds.y + 30, bounds.w - 20, FILTER_HEIGHT),
+                "Type to filter..."
+            );
             
             
             int buttonY = bounds.y + bounds.h - 40;
@@ -43,6 +58,12 @@ namespace ui {
             );
         }
         
+        ~FileDialog() override {
+            for (auto& entry : thumbnailTextures) {
+                if (entry.second.texture) SDL_DestroyTexture(entry.second.texture);
+            }
+        }
+        
         void handleEvent(const SDL_Event& event) override {
             if (!visible) return;
             
@@ -57,33 +78,28 @@ namespace ui {
                         int y = event.button.y;
                         
                         
-                        int listY = bounds.y + 30; 
-                        int listHeight = bounds.h - 80; 
-                        int itemHeight = 25;
+                        int listY = listTop();
+                        int listHeight = visibleRowCount() * ITEM_HEIGHT;
                         
                         if (x >= bounds.x + 10 && x < bounds.x + bounds.w - 10 &&
                             y >= listY && y < listY + listHeight) {
                             
-                            int clickedIndex = (y - listY) / itemHeight + scrollOffset;
-                            if (clickedIndex >= 0 && clickedIndex < static_cast<int>(files.size())) {
-                                selectedIndex = clickedIndex;
+                            int clickedRow = (y - listY) / ITEM_HEIGHT + scrollOffset;
+                            if (clickedRow >= 0 && clickedRow < rowCount()) {
+                                selectedIndex = clickedRow;
                             }
                         }
                     }
+                    // ketikan selalu masuk ke filter, klik di mana pun nggak ngilangin fokusnya
+                    filterInput->setFocused(true);
                     break;
                 }
                 
                 case SDL_MOUSEWHEEL: {
                     
                     if (bounds.contains(event.button.x, event.button.y)) {
-                        scrollOffset -= event.wheel.y;
-                        if (scrollOffset < 0) scrollOffset = 0;
-                        
-                        int maxVisible = (bounds.h - 80) / 25; 
-                        int maxScroll = static_cast<int>(files.size()) - maxVisible;
-                        if (scrollOffset > maxScroll && maxScroll > 0) {
-                            scrollOffset = maxScroll;
-                        }
+                        scrollOffset -= event.wheel.y * 3;
+                        clampScroll();
                     }
                     break;
                 }
@@ -96,22 +112,49 @@ namespace ui {
                             
                         case SDLK_RETURN:
                         case SDLK_KP_ENTER:
+                            // Enter dengan filter yang cuma nyisain satu file langsung milih file itu
+                            if (selectedIndex < 0 && rowCount() == 1) selectedIndex = 0;
                             selectFile();
                             break;
                             
                         case SDLK_UP:
-                            if (selectedIndex > 0) selectedIndex--;
+                            moveSelection(-1);
                             break;
                             
                         case SDLK_DOWN:
-                            if (selectedIndex < static_cast<int>(files.size()) - 1) selectedIndex++;
+                            moveSelection(1);
+                            break;
+                            
+                        case SDLK_PAGEUP:
+                            moveSelection(-visibleRowCount());
+                            break;
+                            
+                        case SDLK_PAGEDOWN:
+                            moveSelection(visibleRowCount());
+                            break;
+                            
+                        default:
+                            filterInput->handleEvent(event);
+                            applyFilter();
                             break;
                     }
                     break;
                 }
+                
+                case SDL_TEXTINPUT: {
+                    filterInput->handleEvent(event);
+                    applyFilter();
+                    break;
+                }
             }
         }
         
+        void update(float deltaTime) override {
+            if (!visible) return;
+            filterInput->update(deltaTime);
+            syncFromIndex();
+        }
+        
         void render(SDL_Renderer* renderer, TTF_Font* font) override {
             if (!visible) return;
             
@@ -125,35 +168,65 @@ namespace ui {
             
             
             if (font) {
-                renderText(renderer, font, "Select OBJ File (models/ folder)", 
-                          bounds.x + 10, bounds.y + 5, textColor);
+                std::string title = "Select Model File (" + directory() + "/ folder)";
+                if (modelIndex && modelIndex->isScanning()) {
+                    title += " - scanning...";
+                }
+                renderText(renderer, font, title, bounds.x + 10, bounds.y + 5, textColor);
             }
             
+            filterInput->render(renderer, font);
+            
             
-            int listY = bounds.y + 30;
-            int listHeight = bounds.h - 80;
-            int itemHeight = 25;
-            int maxVisible = listHeight / itemHeight;
+            // virtualized: cuma baris yang kelihatan yang disentuh, berapa pun jumlah file-nya
+            int listY = listTop();
+            int itemHeight = ITEM_HEIGHT;
+            int maxVisible = visibleRowCount();
+            int listHeight = maxVisible * itemHeight;
+            int totalRows = rowCount();
             
-            for (int i = 0; i < maxVisible && (i + scrollOffset) < static_cast<int>(files.size()); ++i) {
-                int fileIndex = i + scrollOffset;
+            for (int i = 0; i < maxVisible && (i + scrollOffset) < totalRows; ++i) {
+                int row = i + scrollOffset;
+                const graphics::ModelFileInfo& file = fileAt(row);
                 int itemY = listY + i * itemHeight;
                 
                 
-                if (fileIndex == selectedIndex) {
+                if (row == selectedIndex) {
                     Rect itemRect(bounds.x + 5, itemY, bounds.w - 10, itemHeight);
                     renderRect(renderer, itemRect, selectedItemColor);
                 }
                 
                 
+                int textX = bounds.x + 10;
+                if (thumbnailCache) {
+                    int thumbnailSize = thumbnailCache->getThumbnailSize();
+                    SDL_Rect thumbnailRect = {bounds.x + 10, itemY + (itemHeight - thumbnailSize) / 2,
+                                              thumbnailSize, thumbnailSize};
+                    SDL_Texture* thumbnail = getThumbnailTexture(renderer, file);
+                    if (thumbnail) {
+                        SDL_RenderCopy(renderer, thumbnail, nullptr, &thumbnailRect);
+                    } else {
+                        SDL_SetRenderDrawColor(renderer, itemColor.r, itemColor.g, itemColor.b, itemColor.a);
+                        SDL_RenderFillRect(renderer, &thumbnailRect);
+                    }
+                    textX += thumbnailSize + 8;
+                }
+                
                 if (font) {
-                    Color currentTextColor = (fileIndex == selectedIndex) ? Color(255, 255, 255) : textColor;
-                    renderText(renderer, font, files[fileIndex], bounds.x + 10, itemY + 3, currentTextColor);
+                    int textY = itemY + (itemHeight - TTF_FontHeight(font)) / 2;
+                    Color currentTextColor = (row == selectedIndex) ? Color(255, 255, 255) : textColor;
+                    renderText(renderer, font, file.fileName, textX, textY, currentTextColor);
+                    renderText(renderer, font, formatDetails(file), bounds.x + bounds.w - 230, textY,
+                               (row == selectedIndex) ? currentTextColor : detailColor);
                 }
             }
             
+            if (font && totalRows == 0 && files && !files->empty()) {
+                renderText(renderer, font, "No files match the filter", bounds.x + 10, listY + 5, detailColor);
+            }
+            
             
-            if (static_cast<int>(files.size()) > maxVisible) {
+            if (totalRows > maxVisible) {
                 int scrollbarX = bounds.x + bounds.w - 15;
                 int scrollbarY = listY;
                 int scrollbarHeight = listHeight;
@@ -164,8 +237,9 @@ namespace ui {
                 SDL_RenderFillRect(renderer, &trackRect);
                 
                 
-                float thumbHeight = (float)maxVisible / files.size() * scrollbarHeight;
-                float thumbY = (float)scrollOffset / files.size() * scrollbarHeight;
+                // thumb scrollbar tetap kelihatan walaupun daftarnya 100k baris
+                float thumbHeight = std::max(12.0f, (float)maxVisible / totalRows * scrollbarHeight);
+                float thumbY = (float)scrollOffset / std::max(1, totalRows - maxVisible) * (scrollbarHeight - thumbHeight);
                 
                 SDL_SetRenderDrawColor(renderer, 120, 120, 120, 255);
                 SDL_Rect thumbRect = {scrollbarX, (int)(scrollbarY + thumbY), 10, (int)thumbHeight};
@@ -182,21 +256,44 @@ namespace ui {
         
         void show() {
             visible = true;
-            refreshFileList();
             selectedIndex = -1;
             scrollOffset = 0;
+            filterInput->setText("");
+            filterInput->setFocused(true);
+            applyFilter();
+            syncFromIndex();
+        }
+        
+        void setOnFileSelected(FileSelectedCallback callback) {
+            onFileSelected = callback;
         }
         
         void close() {
             visible = false;
+            filterInput->setFocused(false);
         }
         
     private:
+        static constexpr int ITEM_HEIGHT = 40;
+        static constexpr int FILTER_HEIGHT = 26;
+        
+        struct ThumbnailTexture {
+            int64_t modifiedTime = 0;
+            SDL_Texture* texture = nullptr; // nullptr = file gagal di-load, tampilkan kotak kosong
+        };
+        
         FileSelectedCallback onFileSelected;
-        std::vector<std::string> files;
-        int selectedIndex;
+        std::shared_ptr<graphics::ModelIndex> modelIndex;
+        std::shared_ptr<graphics::ThumbnailCache> thumbnailCache;
+        std::unordered_map<std::string, ThumbnailTexture> thumbnailTextures;
+        graphics::ModelIndex::Snapshot files;
+        FuzzyFilter filter;
+        std::string appliedFilterText;
+        int selectedIndex; // baris di daftar yang sudah difilter
         int scrollOffset;
+        uint64_t syncedVersion;
         
+        std::unique_ptr<InputField> filterInput;
         std::unique_ptr<Button> selectButton;
         std::unique_ptr<Button> cancelButton;
         
@@ -204,34 +301,134 @@ namespace ui {
         Color itemColor;
         Color selectedItemColor;
         Color textColor;
+        Color detailColor;
         
-        void refreshFileList() {
-            files.clear();
+        // cuma dipanggil buat baris yang kelihatan, jadi yang dijadwalkan ke worker juga cuma itu
+        SDL_Texture* getThumbnailTexture(SDL_Renderer* renderer, const graphics::ModelFileInfo& info) {
+            auto found = thumbnailTextures.find(info.fileName);
+            if (found != thumbnailTextures.end() && found->second.modifiedTime == info.modifiedTime) {
+                return found->second.texture;
+            }
             
-            try {
-                
-                std::filesystem::path modelsPath = "models";
-                if (std::filesystem::exists(modelsPath) && std::filesystem::is_directory(modelsPath)) {
-                    for (const auto& entry : std::filesystem::directory_iterator(modelsPath)) {
-                        if (entry.is_regular_file() && entry.path().extension() == ".obj") {
-                            files.push_back(entry.path().filename().string());
-                        }
-                    }
+            auto thumbnail = thumbnailCache->request(directory() + "/" + info.fileName, info.modifiedTime);
+            if (!thumbnail) return nullptr;
+            
+            if (found != thumbnailTextures.end() && found->second.texture) {
+                SDL_DestroyTexture(found->second.texture);
+            }
+            ThumbnailTexture& entry = thumbnailTextures[info.fileName];
+            entry.modifiedTime = info.modifiedTime;
+            entry.texture = nullptr;
+            if (!thumbnail->empty()) {
+                entry.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC,
+                                                  thumbnail->width, thumbnail->height);
+                if (entry.texture) {
+                    SDL_UpdateTexture(entry.texture, nullptr, thumbnail->pixels.data(), thumbnail->width * 4);
                 }
-            } catch (const std::exception& e) {
-                
-                files.push_back("teapot.obj");
-                files.push_back("cube.obj");
-                files.push_back("sphere.obj");
             }
+            return entry.texture;
+        }
+        
+        std::string directory() const {
+            return modelIndex ? modelIndex->getDirectory() : std::string("models");
+        }
+        
+        int listTop() const {
+            return bounds.y + 30 + FILTER_HEIGHT + 8;
+        }
+        
+        int visibleRowCount() const {
+            return std::max(1, (bounds.y + bounds.h - 50 - listTop()) / ITEM_HEIGHT);
+        }
+        
+        int rowCount() const {
+            return static_cast<int>(filter.getMatches().size());
+        }
+        
+        const graphics::ModelFileInfo& fileAt(int row) const {
+            return (*files)[filter.getMatches()[row]];
+        }
+        
+        void clampScroll() {
+            int maxScroll = std::max(0, rowCount() - visibleRowCount());
+            scrollOffset = std::clamp(scrollOffset, 0, maxScroll);
+        }
+        
+        void moveSelection(int delta) {
+            if (rowCount() == 0) return;
+            selectedIndex = std::clamp(selectedIndex < 0 ? (delta > 0 ? 0 : rowCount() - 1) : selectedIndex + delta,
+                                       0, rowCount() - 1);
+            // scroll secukupnya biar baris terpilih kelihatan
+            if (selectedIndex < scrollOffset) {
+                scrollOffset = selectedIndex;
+            } else if (selectedIndex >= scrollOffset + visibleRowCount()) {
+                scrollOffset = selectedIndex - visibleRowCount() + 1;
+            }
+            clampScroll();
+        }
+        
+        std::string selectedName() const {
+            return (selectedIndex >= 0 && selectedIndex < rowCount()) ? fileAt(selectedIndex).fileName : std::string();
+        }
+        
+        void reselect(const std::string& name) {
+            selectedIndex = -1;
+            for (int row = 0; row < rowCount() && !name.empty(); ++row) {
+                if (fileAt(row).fileName == name) {
+                    selectedIndex = row;
+                    break;
+                }
+            }
+            clampScroll();
+        }
+        
+        // dipanggil tiap ketikan; query yang cuma nambah huruf nyaring hasil sebelumnya
+        void applyFilter() {
+            if (filterInput->getText() == appliedFilterText) return;
+            appliedFilterText = filterInput->getText();
+            filter.setQuery(appliedFilterText);
+            // hasil filter diurut berdasarkan skor, jadi baris teratas = kandidat terbaik
+            selectedIndex = rowCount() > 0 && !filter.getQuery().empty() ? 0 : -1;
+            scrollOffset = 0;
+        }
+        
+        // ambil snapshot baru cuma kalau index berubah; index filter dibangun ulang, pilihan dipertahankan lewat nama file
+        void syncFromIndex() {
+            if (!modelIndex || (files && modelIndex->getVersion() == syncedVersion)) return;
+            syncedVersion = modelIndex->getVersion();
             
+            std::string previousSelection = selectedName();
+            files = modelIndex->snapshot();
+            filter.build(*files, [](const graphics::ModelFileInfo& info) -> const std::string& { return info.fileName; });
+            reselect(previousSelection);
+        }
+        
+        static std::string formatDetails(const graphics::ModelFileInfo& info) {
+            char buffer[96];
+            double size = static_cast<double>(info.fileSize);
+            const char* unit = "B";
+            if (size >= 1024.0 * 1024.0) {
+                size /= 1024.0 * 1024.0;
+                unit = "MB";
+            } else if (size >= 1024.0) {
+                size /= 1024.0;
+                unit = "KB";
+            }
             
-            std::sort(files.begin(), files.end());
+            if (!info.headerRead) {
+                std::snprintf(buffer, sizeof(buffer), "%.1f %s  ...", size, unit);
+            } else if (info.vertexCount < 0) {
+                std::snprintf(buffer, sizeof(buffer), "%.1f %s", size, unit);
+            } else {
+                std::snprintf(buffer, sizeof(buffer), "%.1f %s  %lldv %lldf", size, unit,
+                              info.vertexCount, info.faceCount);
+            }
+            return buffer;
         }
         
         void selectFile() {
-            if (selectedIndex >= 0 && selectedIndex < static_cast<int>(files.size())) {
-                std::string fullPath = "models/" + files[selectedIndex];
+            if (selectedIndex >= 0 && selectedIndex < rowCount()) {
+                std::string fullPath = directory() + "/" + fileAt(selectedIndex).fileName;
                 if (onFileSelected) {
                     onFileSelected(fullPath);
                 }
@@ -0,0 +1,142 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace ui {
+    // Filter fuzzy (subsequence, case-insensitive) buat daftar nama yang panjang.
+    // Index dibangun sekali per daftar: semua nama lowercase dalam satu buffer + bitmask karakter per nama,
+    // jadi nama yang jelas nggak cocok ditolak tanpa nyentuh string-nya.
+    // Query yang cuma nambah karakter di belakang query sebelumnya cukup nyaring hasil sebelumnya
+    class FuzzyFilter {
+    public:
+        template<typename Container, typename NameOf>
+        void build(const Container& items, NameOf nameOf) {
+            names.clear();
+            offsets.assign(1, 0);
+            masks.clear();
+            offsets.reserve(items.size() + 1);
+            masks.reserve(items.size());
+
+            for (const auto& item : items) {
+                const std::string& name = nameOf(item);
+                uint64_t mask = 0;
+                for (char c : name) {
+                    char lower = toLower(c);
+                    names.push_back(lower);
+                    mask |= charBit(lower);
+                }
+                offsets.push_back(static_cast<uint32_t>(names.size()));
+                masks.push_back(mask);
+            }
+
+            // hasil lama nunjuk ke daftar lama: dibuang dulu supaya setQuery nggak ambil jalan pintas "query sama"
+            std::string previous = query;
+            query.clear();
+            matches.clear();
+            setQuery(previous);
+        }
+
+        void setQuery(const std::string& newQuery) {
+            std::string lowered(newQuery.size(), '\0');
+            std::transform(newQuery.begin(), newQuery.end(), lowered.begin(), toLower);
+
+            if (!matches.empty() && lowered == query) return;
+
+            bool refine = !query.empty() && lowered.size() > query.size() && lowered.compare(0, query.size(), query) == 0;
+            query = lowered;
+
+            if (query.empty()) {
+                matches.resize(size());
+                std::iota(matches.begin(), matches.end(), 0u);
+                return;
+            }
+
+            uint64_t queryMask = 0;
+            for (char c : query) queryMask |= charBit(c);
+
+            std::vector<uint32_t> candidates;
+            if (refine) {
+                candidates.swap(matches);
+            } else {
+                candidates.resize(size());
+                std::iota(candidates.begin(), candidates.end(), 0u);
+            }
+
+            std::vector<std::pair<int, uint32_t>> scored;
+            scored.reserve(candidates.size());
+            for (uint32_t index : candidates) {
+                if ((masks[index] & queryMask) != queryMask) continue;
+                int score;
+                if (match(index, score)) {
+                    scored.emplace_back(score, index);
+                }
+            }
+
+            // skor tertinggi dulu; kalau sama, urutan asli (sudah urut nama) dipertahankan
+            std::stable_sort(scored.begin(), scored.end(),
+                             [](const std::pair<int, uint32_t>& a, const std::pair<int, uint32_t>& b) {
+                                 return a.first > b.first;
+                             });
+            matches.resize(scored.size());
+            for (size_t i = 0; i < scored.size(); ++i) {
+                matches[i] = scored[i].second;
+            }
+        }
+
+        const std::string& getQuery() const { return query; }
+        // index ke daftar asli, urut dari yang paling cocok
+        const std::vector<uint32_t>& getMatches() const { return matches; }
+        size_t size() const { return masks.size(); }
+
+    private:
+        std::vector<char> names;
+        std::vector<uint32_t> offsets;
+        std::vector<uint64_t> masks;
+        std::string query;
+        std::vector<uint32_t> matches;
+
+        static char toLower(char c) {
+            return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+
+        // a-z dan 0-9 dapat bit sendiri, karakter lain berbagi sisa bit
+        static uint64_t charBit(char c) {
+            if (c >= 'a' && c <= 'z') return 1ULL << (c - 'a');
+            if (c >= '0' && c <= '9') return 1ULL << (26 + c - '0');
+            return 1ULL << (36 + static_cast<unsigned char>(c) % 28);
+        }
+
+        static bool isBoundary(char c) {
+            return c == '_' || c == '-' || c == '.' || c == ' ' || c == '/';
+        }
+
+        // greedy: tiap karakter query dicocokkan ke kemunculan berikutnya.
+        // bonus buat huruf yang berurutan dan yang jatuh di awal kata, penalti kecil buat celah
+        bool match(uint32_t index, int& score) const {
+            const char* name = names.data() + offsets[index];
+            int length = static_cast<int>(offsets[index + 1] - offsets[index]);
+            int previous = -1;
+            score = 0;
+
+            int position = 0;
+            for (char c : query) {
+                while (position < length && name[position] != c) ++position;
+                if (position == length) return false;
+
+                score += 1;
+                if (position == previous + 1) score += 4;
+                if (position == 0 || isBoundary(name[position - 1])) score += 3;
+                if (previous >= 0) score -= std::min(position - previous - 1, 3);
+
+                previous = position++;
+            }
+            // nama yang lebih pendek sedikit diunggulkan
+            score -= length / 16;
+            return true;
+        }
+    };
+
+} // namespace ui
@@ -158,6 +158,18 @@ namespace ui {
         
         
         const std::string& getText() const { return text; }
+        
+        bool hasFocus() const { return isFocused; }
+        void setFocused(bool focused) {
+            if (focused == isFocused) return;
+            isFocused = focused;
+            cursorBlinkTime = 0.0f;
+            if (focused) {
+                SDL_StartTextInput();
+            } else {
+                SDL_StopTextInput();
+            }
+        }
         void setText(const std::string& newText) { 
             text = newText; 
             cursorPos = text.length();
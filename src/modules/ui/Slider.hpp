@@ -0,0 +1,118 @@
+#pragma once
+#include "UIComponent.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+
+namespace ui {
+
+    // slider horizontal; callback dipanggil terus selama di-drag (bukan cuma waktu dilepas)
+    class Slider : public UIComponent {
+    public:
+        using ValueCallback = std::function<void(float)>;
+
+        Slider(const Rect& bounds, const std::string& label, float minValue, float maxValue, float value,
+               ValueCallback onValueChanged = nullptr)
+            : UIComponent(bounds), label(label), minValue(minValue), maxValue(maxValue),
+              value(std::clamp(value, minValue, maxValue)), onValueChanged(onValueChanged), dragging(false) {
+
+            trackColor = Color(60, 60, 60, 255);
+            fillColor = Color(0, 120, 215, 255);
+            knobColor = Color(220, 220, 220, 255);
+            textColor = Color(255, 255, 255, 255);
+        }
+
+        void handleEvent(const SDL_Event& event) override {
+            if (!visible || !enabled) return;
+
+            switch (event.type) {
+                case SDL_MOUSEBUTTONDOWN: {
+                    if (event.button.button == SDL_BUTTON_LEFT && getTrackRect().contains(event.button.x, event.button.y)) {
+                        dragging = true;
+                        setValueFromMouse(event.button.x);
+                    }
+                    break;
+                }
+
+                case SDL_MOUSEMOTION: {
+                    if (dragging) {
+                        setValueFromMouse(event.motion.x);
+                    }
+                    break;
+                }
+
+                case SDL_MOUSEBUTTONUP: {
+                    if (event.button.button == SDL_BUTTON_LEFT) {
+                        dragging = false;
+                    }
+                    break;
+                }
+            }
+        }
+
+        void render(SDL_Renderer* renderer, TTF_Font* font) override {
+            if (!visible) return;
+
+            if (font && !label.empty()) {
+                std::ostringstream oss;
+                oss << label << ": " << std::fixed << std::setprecision(1) << value;
+                renderText(renderer, font, oss.str(), bounds.x, bounds.y, enabled ? textColor : Color(128, 128, 128, 255));
+            }
+
+            Rect track = getTrackRect();
+            int knobX = track.x + static_cast<int>(std::lround(getFraction() * static_cast<float>(track.w)));
+
+            renderRect(renderer, Rect(track.x, track.y + track.h / 2 - 2, track.w, 4), trackColor);
+            if (enabled) {
+                renderRect(renderer, Rect(track.x, track.y + track.h / 2 - 2, knobX - track.x, 4), fillColor);
+            }
+            renderRect(renderer, Rect(knobX - 4, track.y, 8, track.h), enabled ? knobColor : Color(90, 90, 90, 255));
+        }
+
+        float getValue() const { return value; }
+        // nggak manggil callback (buat sinkronisasi dari luar)
+        void setValue(float newValue) { value = std::clamp(newValue, minValue, maxValue); }
+        void setCallback(ValueCallback callback) { onValueChanged = callback; }
+        void setLabel(const std::string& newLabel) { label = newLabel; }
+        bool isDragging() const { return dragging; }
+
+    private:
+        std::string label;
+        float minValue;
+        float maxValue;
+        float value;
+        ValueCallback onValueChanged;
+        bool dragging;
+
+        Color trackColor;
+        Color fillColor;
+        Color knobColor;
+        Color textColor;
+
+        static constexpr int LABEL_HEIGHT = 18;
+
+        // baris atas buat teks, sisanya track
+        Rect getTrackRect() const {
+            return Rect(bounds.x + 4, bounds.y + LABEL_HEIGHT, bounds.w - 8, bounds.h - LABEL_HEIGHT);
+        }
+
+        float getFraction() const {
+            return maxValue > minValue ? (value - minValue) / (maxValue - minValue) : 0.0f;
+        }
+
+        void setValueFromMouse(int mouseX) {
+            Rect track = getTrackRect();
+            float fraction = track.w > 0 ? static_cast<float>(mouseX - track.x) / static_cast<float>(track.w) : 0.0f;
+            float newValue = std::clamp(minValue + fraction * (maxValue - minValue), minValue, maxValue);
+            if (newValue != value) {
+                value = newValue;
+                if (onValueChanged) {
+                    onValueChanged(value);
+                }
+            }
+        }
+    };
+
+} // namespace ui
@@ -1,8 +1,11 @@
 #include "UIManager.hpp"
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include "../math/FastTrig.hpp"
+#include "../math/RotationConversion.hpp"
 
 namespace ui {
     
@@ -13,6 +16,11 @@ namespace ui {
             std::cerr << "Gagal inisialisasi font buat UI!" << std::endl;
         }
         
+        // index folder model jalan di background sejak awal, jadi dialog langsung punya isinya
+        modelIndex = std::make_shared<graphics::ModelIndex>("models");
+        modelIndex->start();
+        thumbnailCache = std::make_shared<graphics::ThumbnailCache>(".thumbnails", 36);
+        
         createMainLayout();
     }
     
@@ -133,21 +141,19 @@ namespace ui {
     
     void UIManager::showFileDialog(std::function<void(const std::string&)> onSelected) {
         if (!fileDialog) {
-            int dialogW = 500;
-            int dialogH = 400;
+            int dialogW = 600;
+            int dialogH = 520;
             int dialogX = (screenWidth - dialogW) / 2;
             int dialogY = (screenHeight - dialogH) / 2;
             
             fileDialog = std::make_unique<FileDialog>(
                 Rect(dialogX, dialogY, dialogW, dialogH),
+                modelIndex,
+                thumbnailCache,
                 onSelected
             );
         } else {
-            
-            fileDialog = std::make_unique<FileDialog>(
-                fileDialog->getBounds(),
-                onSelected
-            );
+            fileDialog->setOnFileSelected(onSelected);
         }
         
         fileDialog->show();
@@ -176,6 +182,9 @@ namespace ui {
         createTaitBryanSection();
         createControlButtons();
         createInfoSection();
+        createGimbalExplorerSection();
+        createRotationStackSection();
+        createS3ViewSection();
         
         updateVisiblePanels();
         
@@ -217,12 +226,20 @@ namespace ui {
         Rect fileContentArea = filePanel->getContentArea();
         
         
+        int buttonWidth = (fileContentArea.w - 5) / 2;
         chooseFileButton = createButton(
-            Rect(fileContentArea.x, fileContentArea.y, fileContentArea.w, 25),
-            "Choose OBJ File",
+            Rect(fileContentArea.x, fileContentArea.y, buttonWidth, 25),
+            "Choose Model File",
             [this]() { onChooseFileClicked(); }
         );
         filePanel->addChild(chooseFileButton);
+
+        fitScanButton = createButton(
+            Rect(fileContentArea.x + buttonWidth + 5, fileContentArea.y, buttonWidth, 25),
+            "Fit ke Scan...",
+            [this]() { onFitScanClicked(); }
+        );
+        filePanel->addChild(fitScanButton);
         
         
         fileNameLabel = createLabel(
@@ -274,7 +291,7 @@ namespace ui {
         
         
         auto angleLabel = createLabel(Rect(rotContentArea.x, rotContentArea.y + 60, rotContentArea.w, 20), 
-                                     "Sudut Rotasi (degrees):");
+                                     "Sudut Rotasi (degrees; Spin: °/detik):");
         rotationPanel->addChild(angleLabel);
         
         angleInput = createInputField(Rect(rotContentArea.x, rotContentArea.y + 85, rotContentArea.w, 25), "45.0");
@@ -282,14 +299,24 @@ namespace ui {
         rotationPanel->addChild(angleInput);
         
         
-        auto quatLabel = createLabel(Rect(rotContentArea.x, rotContentArea.y + 120, rotContentArea.w, 20), 
+        int halfWidth = rotContentArea.w / 2;
+        auto quatLabel = createLabel(Rect(rotContentArea.x, rotContentArea.y + 120, halfWidth, 20), 
                                     "Quaternion:");
         rotationPanel->addChild(quatLabel);
         
-        quaternionDisplay = createLabel(Rect(rotContentArea.x, rotContentArea.y + 145, rotContentArea.w, 20), 
+        quaternionDisplay = createLabel(Rect(rotContentArea.x, rotContentArea.y + 145, halfWidth, 20), 
                                        "q = (1.0, 0.0, 0.0, 0.0)");
         quaternionDisplay->setTextColor(Color(100, 200, 100, 255)); 
         rotationPanel->addChild(quaternionDisplay);
+
+        // kosong selama library orientasi belum dimuat
+        nearOrientationCount = createLabel(Rect(rotContentArea.x + halfWidth, rotContentArea.y + 120, halfWidth, 20), "");
+        nearOrientationCount->setTextColor(Color(150, 150, 150, 255));
+        rotationPanel->addChild(nearOrientationCount);
+
+        nearestOrientationDisplay = createLabel(Rect(rotContentArea.x + halfWidth, rotContentArea.y + 145, halfWidth, 20), "");
+        nearestOrientationDisplay->setTextColor(Color(200, 170, 90, 255));
+        rotationPanel->addChild(nearestOrientationDisplay);
     }
 
     void UIManager::createMethodSelection() {
@@ -307,14 +334,30 @@ namespace ui {
             "Tait-Bryan"
         };
         
+        int halfWidth = (methodContentArea.w - 10) / 2;
         methodSelector = std::make_shared<RadioButton>(
-            Rect(methodContentArea.x, methodContentArea.y, methodContentArea.w, 60),
+            Rect(methodContentArea.x, methodContentArea.y, halfWidth, 60),
             methods,
             0,
             [this](int index) { onMethodChanged(index); }
         );
         
         methodPanel->addChild(methodSelector);
+
+        // split-screen: ketiga metode berdampingan dengan input panel masing-masing, tiap viewport punya kamera sendiri
+        compareViewButton = createButton(
+            Rect(methodContentArea.x + halfWidth + 10, methodContentArea.y, halfWidth, 25),
+            "Bandingkan: OFF",
+            [this]() {
+                compareViewEnabled = !compareViewEnabled;
+                compareViewButton->setText(compareViewEnabled ? "Bandingkan: ON" : "Bandingkan: OFF");
+                statusLabel->setText(compareViewEnabled
+                    ? "Tampilan banding: kamera viewport di bawah kursor yang digerakkan"
+                    : "Tampilan banding mati");
+                if (onCompareViewToggled) onCompareViewToggled(compareViewEnabled);
+            }
+        );
+        methodPanel->addChild(compareViewButton);
     }
 
     void UIManager::createEulerSection() {
@@ -404,6 +447,233 @@ namespace ui {
         taitBryanPanel->addChild(descLabel);
     }
 
+    void UIManager::createGimbalExplorerSection() {
+        gimbalPanel = createPanel(Rect(10, 10, 320, 370), "Gimbal Lock Explorer");
+        addComponent(gimbalPanel);
+
+        Rect content = gimbalPanel->getContentArea();
+
+        int halfWidth = (content.w - 10) / 2;
+        gimbalToggleButton = createButton(
+            Rect(content.x, content.y, halfWidth, 25),
+            "Explorer: OFF",
+            [this]() { onGimbalToggleClicked(); }
+        );
+        gimbalPanel->addChild(gimbalToggleButton);
+
+        // klik = urutan sumbu berikutnya (12 urutan intrinsic, lihat math::AxisOrder)
+        gimbalOrderButton = createButton(
+            Rect(content.x + halfWidth + 10, content.y, halfWidth, 25),
+            "",
+            [this]() { onGimbalOrderClicked(); }
+        );
+        gimbalPanel->addChild(gimbalOrderButton);
+
+        auto sweepLabel = createLabel(Rect(content.x, content.y + 32, content.w, 20), "Sudut yang di-sweep (-180..180):");
+        gimbalPanel->addChild(sweepLabel);
+
+        gimbalParameterSelector = std::make_shared<RadioButton>(
+            Rect(content.x, content.y + 55, content.w, 66),
+            std::vector<std::string>{"Sudut pertama", "Sudut kedua", "Sudut ketiga"},
+            1
+        );
+        gimbalPanel->addChild(gimbalParameterSelector);
+
+        const float initialAngles[3] = {30.0f, 0.0f, 20.0f};
+        for (int i = 0; i < 3; ++i) {
+            gimbalSliders[i] = std::make_shared<Slider>(
+                Rect(content.x, content.y + 130 + i * 42, content.w, 36),
+                "", -180.0f, 180.0f, initialAngles[i]
+            );
+            gimbalPanel->addChild(gimbalSliders[i]);
+        }
+
+        for (int i = 0; i < 2; ++i) {
+            gimbalStatusLabels[i] = createLabel(Rect(content.x, content.y + 262 + i * 22, content.w, 20), "");
+            gimbalStatusLabels[i]->setTextColor(Color(180, 180, 180, 255));
+            gimbalPanel->addChild(gimbalStatusLabels[i]);
+        }
+        updateGimbalOrderLabels();
+    }
+
+    void UIManager::onGimbalOrderClicked() {
+        gimbalAxisOrder = (gimbalAxisOrder + 1) % math::AXIS_ORDER_COUNT;
+        updateGimbalOrderLabels();
+    }
+
+    // label slider ikut sumbunya, mis. ZYX -> "Sudut 1 (Z)", "Sudut 2 (Y')", "Sudut 3 (X'')"
+    void UIManager::updateGimbalOrderLabels() {
+        const char* name = math::detail::axisOrderName(static_cast<math::AxisOrder>(gimbalAxisOrder));
+        gimbalOrderButton->setText(std::string("Urutan: ") + name);
+        const char* primes[3] = {"", "'", "''"};
+        for (int i = 0; i < 3; ++i) {
+            gimbalSliders[i]->setLabel("Sudut " + std::to_string(i + 1) + " (" + name[i] + primes[i] + ")");
+        }
+    }
+
+    void UIManager::onGimbalToggleClicked() {
+        gimbalExplorerEnabled = !gimbalExplorerEnabled;
+        gimbalToggleButton->setText(gimbalExplorerEnabled ? "Explorer: ON" : "Explorer: OFF");
+        statusLabel->setText(gimbalExplorerEnabled ? "Gimbal explorer aktif" : "Gimbal explorer mati");
+    }
+
+    void UIManager::createRotationStackSection() {
+        stackPanel = createPanel(Rect(10, 390, 320, 230), "Rotation Stack");
+        addComponent(stackPanel);
+
+        Rect content = stackPanel->getContentArea();
+
+        stackPositionLabel = createLabel(Rect(content.x, content.y, content.w, 20), "");
+        stackPanel->addChild(stackPositionLabel);
+
+        // < dan > pilih langkah; Sisip/Ganti pakai parameter rotasi yang sedang aktif di panel kanan
+        int buttonWidth = (content.w - 20) / 5;
+        const char* labels[5] = {"<", ">", "Sisip", "Ganti", "Hapus"};
+        std::function<void()> actions[5] = {
+            [this]() { selectStackStep(-1); },
+            [this]() { selectStackStep(1); },
+            [this]() { if (onInsertStackStep) onInsertStackStep(); },
+            [this]() { if (onReplaceStackStep) onReplaceStackStep(); },
+            [this]() { if (onRemoveStackStep) onRemoveStackStep(); }
+        };
+        for (int i = 0; i < 5; ++i) {
+            auto button = createButton(Rect(content.x + i * (buttonWidth + 5), content.y + 25, buttonWidth, 25),
+                                       labels[i], actions[i]);
+            stackPanel->addChild(button);
+        }
+
+        stackStepLabel = createLabel(Rect(content.x, content.y + 60, content.w, 20), "");
+        stackStepLabel->setTextColor(Color(100, 200, 100, 255));
+        stackPanel->addChild(stackStepLabel);
+
+        stackPoseLabel = createLabel(Rect(content.x, content.y + 85, content.w, 20), "");
+        stackPoseLabel->setTextColor(Color(90, 150, 220, 255));
+        stackPanel->addChild(stackPoseLabel);
+
+        // pose antara di sepanjang jalur identitas -> hasil stack, 0 = mati
+        ghostCountSlider = std::make_shared<Slider>(Rect(content.x, content.y + 110, content.w, 36),
+                                                    "Ghost (onion skin)", 0.0f, 64.0f, 8.0f);
+        stackPanel->addChild(ghostCountSlider);
+
+        setRotationStackState(0, 0, "Stack kosong", "");
+    }
+
+    size_t UIManager::getGhostCount() const {
+        return static_cast<size_t>(std::lround(ghostCountSlider->getValue()));
+    }
+
+    void UIManager::selectStackStep(int delta) {
+        if (stackStepCount == 0) return;
+        if (delta < 0 && selectedStackStep > 0) --selectedStackStep;
+        if (delta > 0 && selectedStackStep + 1 < stackStepCount) ++selectedStackStep;
+        if (onStackSelectionChanged) {
+            onStackSelectionChanged();
+        }
+    }
+
+    void UIManager::setRotationStackState(size_t selected, size_t count, const std::string& stepText, const std::string& poseText) {
+        stackStepCount = count;
+        selectedStackStep = count > 0 ? std::min(selected, count - 1) : 0;
+        stackPositionLabel->setText(count > 0
+            ? "Langkah " + std::to_string(selectedStackStep + 1) + " / " + std::to_string(count)
+            : "Langkah - / 0");
+        stackStepLabel->setText(stepText);
+        stackPoseLabel->setText(poseText);
+    }
+
+    void UIManager::createS3ViewSection() {
+        s3Panel = createPanel(Rect(10, 630, 320, 200), "Quaternion di S³");
+        addComponent(s3Panel);
+
+        Rect content = s3Panel->getContentArea();
+
+        // klik = mode / himpunan sampel berikutnya
+        int halfWidth = (content.w - 10) / 2;
+        s3ModeButton = createButton(Rect(content.x, content.y, halfWidth, 25), "", [this]() {
+            s3ViewMode = static_cast<S3ViewMode>((static_cast<int>(s3ViewMode) + 1) % 3);
+            updateS3ViewLabels();
+        });
+        s3Panel->addChild(s3ModeButton);
+
+        s3SampleSetButton = createButton(Rect(content.x + halfWidth + 10, content.y, halfWidth, 25), "", [this]() {
+            s3SampleSet = static_cast<S3SampleSet>((static_cast<int>(s3SampleSet) + 1) % 3);
+            updateS3ViewLabels();
+        });
+        s3Panel->addChild(s3SampleSetButton);
+
+        s3CountSlider = std::make_shared<Slider>(Rect(content.x, content.y + 32, content.w, 36),
+                                                 "Jumlah titik (10^n)", 3.0f, 6.5f, 5.0f);
+        s3Panel->addChild(s3CountSlider);
+
+        s3RadiusSlider = std::make_shared<Slider>(Rect(content.x, content.y + 74, content.w, 36),
+                                                  "Radius sekitar pose (°)", 1.0f, 180.0f, 30.0f);
+        s3Panel->addChild(s3RadiusSlider);
+
+        s3StatusLabel = createLabel(Rect(content.x, content.y + 116, content.w, 20), "");
+        s3StatusLabel->setTextColor(Color(180, 180, 180, 255));
+        s3Panel->addChild(s3StatusLabel);
+
+        updateS3ViewLabels();
+    }
+
+    void UIManager::updateS3ViewLabels() {
+        const char* modes[3] = {"S³: OFF", "S³: Stereografik", "S³: Hopf"};
+        const char* sets[3] = {"Sekitar pose", "Trajektori", "Seluruh SO(3)"};
+        s3ModeButton->setText(modes[static_cast<int>(s3ViewMode)]);
+        s3SampleSetButton->setText(sets[static_cast<int>(s3SampleSet)]);
+        s3RadiusSlider->setEnabled(s3SampleSet == S3SampleSet::NEAR_POSE);
+        if (s3ViewMode == S3ViewMode::OFF) s3StatusLabel->setText("");
+    }
+
+    size_t UIManager::getS3PointCount() const {
+        return static_cast<size_t>(std::pow(10.0f, s3CountSlider->getValue()));
+    }
+
+    float UIManager::getS3NearRadius() const {
+        return s3RadiusSlider->getValue();
+    }
+
+    void UIManager::setS3ViewStatus(const std::string& text) {
+        s3StatusLabel->setText(text);
+    }
+
+    int UIManager::getGimbalSweepParameter() const {
+        return gimbalParameterSelector ? gimbalParameterSelector->getSelectedIndex() : 1;
+    }
+
+    void UIManager::getGimbalExplorerAngles(float& first, float& second, float& third) const {
+        first = gimbalSliders[0] ? gimbalSliders[0]->getValue() : 0.0f;
+        second = gimbalSliders[1] ? gimbalSliders[1]->getValue() : 0.0f;
+        third = gimbalSliders[2] ? gimbalSliders[2]->getValue() : 0.0f;
+    }
+
+    void UIManager::setGimbalExplorerStatus(const std::string& line1, const std::string& line2) {
+        gimbalStatusLabels[0]->setText(line1);
+        gimbalStatusLabels[1]->setText(line2);
+    }
+
+    void UIManager::setSpinEnabled(bool enabled) {
+        spinEnabled = enabled;
+        spinButton->setText(enabled ? "Spin (kecepatan sudut): ON" : "Spin (kecepatan sudut): OFF");
+    }
+
+    void UIManager::setStatus(const std::string& text) {
+        statusLabel->setText(text);
+    }
+
+    void UIManager::setNearestOrientation(const std::string& nearestText, const std::string& countText) {
+        nearestOrientationDisplay->setText(nearestText);
+        nearOrientationCount->setText(countText);
+    }
+
+    void UIManager::setRotationMethod(RotationMethod method) {
+        currentMethod = method;
+        if (methodSelector) {
+            methodSelector->setSelectedIndex(static_cast<int>(method));
+        }
+        updateVisiblePanels();
+    }
+
     void UIManager::onMethodChanged(int methodIndex) {
         currentMethod = static_cast<RotationMethod>(methodIndex);
         updateVisiblePanels();
@@ -441,6 +711,18 @@ namespace ui {
         );
         resetButton->setColors(Color(120, 50, 0, 255), Color(140, 60, 0, 255), Color(100, 40, 0, 255)); 
         mainPanel->addChild(resetButton);
+
+        // spin: sumbu & sudut panel quaternion dibaca sebagai kecepatan sudut, pose diintegrasi tiap frame
+        spinButton = createButton(
+            Rect(contentArea.x, buttonY + 40, contentArea.w, 28),
+            "",
+            [this]() {
+                setSpinEnabled(!spinEnabled);
+                if (onSpinToggled) onSpinToggled(spinEnabled);
+            }
+        );
+        mainPanel->addChild(spinButton);
+        setSpinEnabled(false);
     }
     
     
@@ -453,6 +735,15 @@ namespace ui {
         });
     }
     
+    // target = mesh yang sama sesudah diputar (vertex berpasangan per index), mis. hasil scan
+    void UIManager::onFitScanClicked() {
+        showFileDialog([this](const std::string& filename) {
+            if (onFitTargetSelected) {
+                onFitTargetSelected(filename);
+            }
+        });
+    }
+    
     void UIManager::onApplyClicked() {
         normalizeAxis();
         if (onApplyRotation) {
@@ -491,9 +782,9 @@ namespace ui {
         getRotationAxis(x, y, z);
         
         
-        float halfAngle = angle * 0.5f * (3.14159265f / 180.0f); 
-        float sinHalf = std::sin(halfAngle);
-        float cosHalf = std::cos(halfAngle);
+        float halfAngle = angle * 0.5f * math::FastTrig<float>::DEGREES_TO_RADIANS;
+        float sinHalf, cosHalf;
+        math::FastTrig<float>::sincos(halfAngle, sinHalf, cosHalf);
         
         float qw = cosHalf;
         float qx = x * sinHalf;
@@ -6,6 +6,7 @@
 #include "Panel.hpp"
 #include "FileDialog.hpp"
 #include "RadioButton.hpp"
+#include "Slider.hpp"
 #include <SDL_ttf.h>
 #include <vector>
 #include <memory>
@@ -19,6 +20,19 @@ namespace ui {
         TAIT_BRYAN = 2
     };
     
+    // tampilan quaternion di S^3 (panel kiri, di bawah rotation stack)
+    enum class S3ViewMode {
+        OFF = 0,
+        STEREOGRAPHIC = 1,
+        HOPF = 2
+    };
+
+    enum class S3SampleSet {
+        NEAR_POSE = 0,  // rotasi acak di sekitar pose sekarang
+        TRAJECTORY = 1, // lintasan identitas -> tiap langkah rotation stack
+        UNIFORM = 2     // seluruh SO(3)
+    };
+    
     struct UITheme {
         Color backgroundColor = Color(30, 30, 30, 255);
         Color panelColor = Color(40, 40, 40, 255);
@@ -76,10 +90,49 @@ namespace ui {
         
         void getTaitBryanAngles(float& yaw, float& pitch, float& roll) const;
         void setTaitBryanAngles(float yaw, float pitch, float roll);
+
+        // gimbal-lock explorer (panel kiri): satu sudut di-sweep penuh, dua lainnya ditahan di nilai slider
+        bool isGimbalExplorerEnabled() const { return gimbalExplorerEnabled; }
+        int getGimbalSweepParameter() const;
+        // index math::AxisOrder (intrinsic)
+        int getGimbalAxisOrder() const { return gimbalAxisOrder; }
+        void getGimbalExplorerAngles(float& first, float& second, float& third) const;
+        void setGimbalExplorerStatus(const std::string& line1, const std::string& line2);
+        void setStatus(const std::string& text);
+        // orientasi library terdekat dari pose yang sedang diedit, di samping tampilan quaternion
+        void setNearestOrientation(const std::string& nearestText, const std::string& countText);
         
         std::function<void(const std::string&)> onFileSelected;
+        // "Fit ke Scan": file target dipilih, rotasi best-fit-nya diisi ke field quaternion (belum di-Apply)
+        std::function<void(const std::string&)> onFitTargetSelected;
         std::function<void()> onApplyRotation;
         std::function<void()> onResetRotation;
+
+        // tampilan banding tiga metode (quaternion, Euler, Tait-Bryan), satu viewport per metode
+        bool isCompareViewEnabled() const { return compareViewEnabled; }
+        std::function<void(bool)> onCompareViewToggled;
+
+        // mode spin: pose berputar terus dengan kecepatan sudut = sumbu * sudut (°/detik) dari panel quaternion.
+        // setSpinEnabled cuma ganti state & tombol (nggak manggil onSpinToggled)
+        bool isSpinEnabled() const { return spinEnabled; }
+        void setSpinEnabled(bool enabled);
+        std::function<void(bool)> onSpinToggled;
+
+        // rotation stack (panel kiri bawah): langkah yang dipilih bisa disisip sebelum-nya, diganti, atau dihapus
+        size_t getSelectedStackStep() const { return selectedStackStep; }
+        void setRotationStackState(size_t selected, size_t count, const std::string& stepText, const std::string& poseText);
+        std::function<void()> onInsertStackStep;
+        std::function<void()> onReplaceStackStep;
+        std::function<void()> onRemoveStackStep;
+        std::function<void()> onStackSelectionChanged;
+        size_t getGhostCount() const;
+
+        // tampilan S^3: jumlah titik dari slider log10, radius sekitar pose dalam derajat
+        S3ViewMode getS3ViewMode() const { return s3ViewMode; }
+        S3SampleSet getS3SampleSet() const { return s3SampleSet; }
+        size_t getS3PointCount() const;
+        float getS3NearRadius() const;
+        void setS3ViewStatus(const std::string& text);
         
     private:
         SDL_Renderer* renderer;
@@ -89,6 +142,8 @@ namespace ui {
         
         std::vector<std::shared_ptr<UIComponent>> components;
         std::unique_ptr<FileDialog> fileDialog;
+        std::shared_ptr<graphics::ModelIndex> modelIndex;
+        std::shared_ptr<graphics::ThumbnailCache> thumbnailCache;
         
         
         std::shared_ptr<Panel> mainPanel;
@@ -97,6 +152,7 @@ namespace ui {
         std::shared_ptr<Panel> infoPanel;
         
         std::shared_ptr<Button> chooseFileButton;
+        std::shared_ptr<Button> fitScanButton;
         std::shared_ptr<Label> fileNameLabel;
         
         std::shared_ptr<InputField> axisXInput;
@@ -106,8 +162,14 @@ namespace ui {
         
         std::shared_ptr<Button> applyButton;
         std::shared_ptr<Button> resetButton;
+        std::shared_ptr<Button> spinButton;
+        bool spinEnabled = false;
+        std::shared_ptr<Button> compareViewButton;
+        bool compareViewEnabled = false;
         
         std::shared_ptr<Label> quaternionDisplay;
+        std::shared_ptr<Label> nearestOrientationDisplay;
+        std::shared_ptr<Label> nearOrientationCount;
         std::shared_ptr<Label> statusLabel;
         
         bool initializeFont();
@@ -118,6 +180,7 @@ namespace ui {
         void createControlButtons();
         
         void onChooseFileClicked();
+        void onFitScanClicked();
         void onApplyClicked();
         void onResetClicked();
         void onAxisChanged();
@@ -146,6 +209,42 @@ namespace ui {
         void createTaitBryanSection();
         void onMethodChanged(int methodIndex);
         void updateVisiblePanels();
+
+        bool gimbalExplorerEnabled = false;
+        int gimbalAxisOrder = 5; // ZYX
+        std::shared_ptr<Button> gimbalOrderButton;
+        std::shared_ptr<Panel> gimbalPanel;
+        std::shared_ptr<Button> gimbalToggleButton;
+        std::shared_ptr<RadioButton> gimbalParameterSelector;
+        std::shared_ptr<Slider> gimbalSliders[3];
+        std::shared_ptr<Label> gimbalStatusLabels[2];
+
+        S3ViewMode s3ViewMode = S3ViewMode::OFF;
+        S3SampleSet s3SampleSet = S3SampleSet::NEAR_POSE;
+        std::shared_ptr<Panel> s3Panel;
+        std::shared_ptr<Button> s3ModeButton;
+        std::shared_ptr<Button> s3SampleSetButton;
+        std::shared_ptr<Slider> s3CountSlider;
+        std::shared_ptr<Slider> s3RadiusSlider;
+        std::shared_ptr<Label> s3StatusLabel;
+        void updateS3ViewLabels();
+
+        void createGimbalExplorerSection();
+        void createS3ViewSection();
+
+        size_t selectedStackStep = 0;
+        size_t stackStepCount = 0;
+        std::shared_ptr<Panel> stackPanel;
+        std::shared_ptr<Label> stackPositionLabel;
+        std::shared_ptr<Label> stackStepLabel;
+        std::shared_ptr<Label> stackPoseLabel;
+        std::shared_ptr<Slider> ghostCountSlider;
+
+        void createRotationStackSection();
+        void selectStackStep(int delta);
+        void onGimbalToggleClicked();
+        void onGimbalOrderClicked();
+        void updateGimbalOrderLabels();
     };
     
 } 
\ No newline at end of file
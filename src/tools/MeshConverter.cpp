@@ -0,0 +1,94 @@
+// MeshConverter.cpp
+// Konversi semua model (.obj, .stl, .ply) di sebuah folder (default: models/) ke format terkompresi .qmesh
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include "../modules/graphics/Mesh.hpp"
+#include "../modules/graphics/MeshLoader.hpp"
+#include "../modules/graphics/MeshWelder.hpp"
+#include "../modules/graphics/MeshCodec.hpp"
+
+namespace {
+    using Meshf = graphics::Mesh<float>;
+
+    void printUsage(const char* programName) {
+        std::cout << "Pemakaian: " << programName << " [folder=models] [--no-weld]" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::filesystem::path modelsPath = "models";
+    bool weldVertices = true;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--no-weld") {
+            weldVertices = false;
+        } else if (arg == "-h" || arg == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        } else {
+            modelsPath = arg;
+        }
+    }
+
+    if (!std::filesystem::is_directory(modelsPath)) {
+        std::cerr << "Folder tidak ditemukan: " << modelsPath << std::endl;
+        return 1;
+    }
+
+    uintmax_t totalInput = 0;
+    uintmax_t totalOutput = 0;
+    int converted = 0;
+
+    for (const auto& entry : std::filesystem::directory_iterator(modelsPath)) {
+        std::string extension = entry.path().extension().string();
+        if (!entry.is_regular_file() || extension == graphics::MeshCodec<float>::FILE_EXTENSION ||
+            !graphics::MeshLoader<float>::isSupportedExtension(extension)) {
+            continue;
+        }
+
+        const std::filesystem::path& inputPath = entry.path();
+        std::filesystem::path outputPath = inputPath;
+        outputPath.replace_extension(graphics::MeshCodec<float>::FILE_EXTENSION);
+
+        try {
+            Meshf mesh = graphics::MeshLoader<float>::loadFromFile(inputPath.string());
+            if (mesh.empty()) {
+                std::cerr << "Lewati (mesh kosong): " << inputPath << std::endl;
+                continue;
+            }
+            if (weldVertices) {
+                graphics::MeshWelder<float>::weld(mesh, 1e-5f);
+            }
+
+            if (!graphics::MeshCodec<float>::saveToFile(mesh, outputPath.string())) {
+                continue;
+            }
+
+            // ukur waktu decode biar kelihatan throughput-nya
+            auto start = std::chrono::steady_clock::now();
+            Meshf decoded = graphics::MeshCodec<float>::loadFromFile(outputPath.string());
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            uintmax_t inputSize = std::filesystem::file_size(inputPath);
+            uintmax_t outputSize = std::filesystem::file_size(outputPath);
+            totalInput += inputSize;
+            totalOutput += outputSize;
+            converted++;
+
+            std::cout << inputPath.filename().string() << " -> " << outputPath.filename().string() << ": "
+                      << inputSize << " -> " << outputSize << " byte ("
+                      << (outputSize > 0 ? static_cast<double>(inputSize) / outputSize : 0.0) << "x), "
+                      << decoded.vertexCount() << " vertex, " << decoded.faces.size() << " face, decode "
+                      << seconds * 1000.0 << " ms" << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << "Gagal konversi " << inputPath << ": " << e.what() << std::endl;
+        }
+    }
+
+    std::cout << converted << " file dikonversi, total " << totalInput << " -> " << totalOutput << " byte" << std::endl;
+    return 0;
+}